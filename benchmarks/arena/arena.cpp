@@ -0,0 +1,97 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+// Build and teardown of the per-request object graph: exl::box allocated from the heap compared
+// with exl::arena_box released by exl::arena::reset
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include <exl/arena.hpp>
+#include <exl/box.hpp>
+
+#include <Benchmark.hpp>
+
+namespace
+{
+    constexpr size_t graph_nodes = 50000;
+
+    /// @brief List node of the request graph, Box is the box template of the link
+    template <template <typename> class Box>
+    struct Node
+    {
+        uint64_t key;
+        uint64_t payload[3];
+        Box<Node> next;
+
+        explicit Node(uint64_t nodeKey) noexcept
+                : key(nodeKey)
+                , payload {}
+                , next(nullptr) {}
+
+        // Iterative destruction: recursion over the 50K links would overflow the stack
+        ~Node()
+        {
+            Box<Node> current = std::move(next);
+            while (current.is_valid())
+            {
+                Box<Node> following = std::move(current->next);
+                current = std::move(following);
+            }
+        }
+    };
+
+    template <typename T>
+    using heap_box = exl::box<T>;
+
+    void heap_graph(size_t iterations)
+    {
+        using node_t = Node<heap_box>;
+
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            auto head = heap_box<node_t>::make(uint64_t(0));
+            for (uint64_t key = 1; key < graph_nodes; ++key)
+            {
+                auto node = heap_box<node_t>::make(key);
+                node->next = std::move(head);
+                head = std::move(node);
+            }
+            exl::bench::do_not_optimize(head);
+        }
+    }
+
+    void arena_graph(size_t iterations)
+    {
+        using node_t = Node<exl::arena_box>;
+
+        exl::arena arena;
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            {
+                auto head = arena.make<node_t>(uint64_t(0));
+                for (uint64_t key = 1; key < graph_nodes; ++key)
+                {
+                    auto node = arena.make<node_t>(key);
+                    node->next = std::move(head);
+                    head = std::move(node);
+                }
+                exl::bench::do_not_optimize(head);
+            }
+            arena.reset();
+        }
+    }
+
+    bool register_arena_benchmarks()
+    {
+        exl::bench::register_benchmark("arena/graph_50k/box", &heap_graph);
+        exl::bench::register_benchmark("arena/graph_50k/arena_box", &arena_graph);
+        return true;
+    }
+
+    const bool registered = register_arena_benchmarks();
+}
@@ -0,0 +1,72 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+// Growth of the receive buffer by the small appends: (exl::box<T[]>, size) pair which is
+// reallocated and copied on each append compared with exl::array_box::resize
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <exl/array_box.hpp>
+#include <exl/box.hpp>
+
+#include <Benchmark.hpp>
+
+namespace
+{
+    constexpr size_t append_size = 64;
+    constexpr size_t max_buffer_size = 64 * 1024;
+
+    void box_pair_append(size_t iterations)
+    {
+        auto buffer = exl::box<uint8_t[]>::make_array(0);
+        size_t size = 0;
+
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            if (size == max_buffer_size)
+            {
+                buffer = exl::box<uint8_t[]>::make_array(0);
+                size = 0;
+            }
+
+            auto grown = exl::box<uint8_t[]>::make_array(size + append_size);
+            std::memcpy(&grown[0], &buffer[0], size);
+            std::memset(&grown[size], static_cast<int>(i), append_size);
+
+            buffer = std::move(grown);
+            size += append_size;
+        }
+        exl::bench::do_not_optimize(buffer);
+    }
+
+    void array_box_append(size_t iterations)
+    {
+        auto buffer = exl::array_box<uint8_t>::make(0);
+
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            if (buffer.size() == max_buffer_size)
+            {
+                buffer.resize(0);
+            }
+
+            const size_t size = buffer.size();
+            buffer.resize(size + append_size);
+            std::memset(buffer.data() + size, static_cast<int>(i), append_size);
+        }
+        exl::bench::do_not_optimize(buffer);
+    }
+
+    bool register_array_box_benchmarks()
+    {
+        exl::bench::register_benchmark("array_box/append_64b/box_pair", &box_pair_append);
+        exl::bench::register_benchmark("array_box/append_64b/resize", &array_box_append);
+        return true;
+    }
+
+    const bool registered = register_array_box_benchmarks();
+}
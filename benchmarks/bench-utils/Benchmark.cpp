@@ -0,0 +1,88 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "Benchmark.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <utility>
+#include <vector>
+
+namespace exl { namespace bench
+{
+    namespace
+    {
+        using Clock = std::chrono::steady_clock;
+
+        using Registry = std::vector<std::pair<std::string, BenchmarkFunction>>;
+
+        constexpr double MIN_MEASUREMENT_NS = 100.0 * 1000 * 1000;
+        constexpr size_t MAX_ITERATIONS = size_t(1) << 34;
+        constexpr int REPETITIONS = 3;
+
+        Registry& registry()
+        {
+            static Registry benchmarks;
+            return benchmarks;
+        }
+
+        double measure_ns(BenchmarkFunction function, size_t iterations)
+        {
+            const auto start = Clock::now();
+            function(iterations);
+            const auto end = Clock::now();
+
+            return std::chrono::duration<double, std::nano>(end - start).count();
+        }
+    }
+
+    bool register_benchmark(const std::string& name, BenchmarkFunction function)
+    {
+        registry().emplace_back(name, function);
+        return true;
+    }
+
+    void run_benchmarks(const std::string& filter)
+    {
+        std::printf("name,iterations,ns_per_iteration\n");
+
+        for (const auto& benchmark : registry())
+        {
+            const std::string& name = benchmark.first;
+            if (name.compare(0, filter.size(), filter) != 0)
+            {
+                continue;
+            }
+
+            // Warm-up call, which also performs the lazy setup of the benchmark (e.g. filling
+            // of the static tables), so the setup time is not taken as the iteration time
+            benchmark.second(1);
+
+            // Grow iterations count until the measurement becomes long enough to be stable
+            size_t iterations = 1;
+            double elapsed = measure_ns(benchmark.second, iterations);
+            while (elapsed < MIN_MEASUREMENT_NS && iterations < MAX_ITERATIONS)
+            {
+                iterations *= (elapsed * 10 < MIN_MEASUREMENT_NS) ? 10 : 2;
+                elapsed = measure_ns(benchmark.second, iterations);
+            }
+
+            // Report the best of few runs to reduce the noise
+            for (int i = 1; i < REPETITIONS; ++i)
+            {
+                const double repeated = measure_ns(benchmark.second, iterations);
+                elapsed = (repeated < elapsed) ? repeated : elapsed;
+            }
+
+            std::printf(
+                    "%s,%zu,%.3f\n",
+                    name.c_str(),
+                    iterations,
+                    elapsed / static_cast<double>(iterations)
+            );
+            std::fflush(stdout);
+        }
+    }
+}}
@@ -0,0 +1,95 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace exl { namespace bench
+{
+    /// @brief Benchmark body: should perform the measured operation the given number of times
+    using BenchmarkFunction = void (*)(size_t iterations);
+
+    /// @brief Registers benchmark to be run by run_benchmarks
+    /// @return always true, allows registration during static initialization
+    bool register_benchmark(const std::string& name, BenchmarkFunction function);
+
+    /// @brief Runs all registered benchmarks which names start with the given prefix and prints
+    /// results to the standard output in CSV format: "name,iterations,ns_per_iteration"
+    void run_benchmarks(const std::string& filter);
+
+    /// @brief Fast deterministic pseudo-random generator (xorshift64), used to produce input
+    /// patterns which can't be learned by the branch predictor
+    class Random
+    {
+    public:
+        explicit Random(uint64_t seed = 0x9E3779B97F4A7C15ull)
+            : state_(seed)
+        {}
+
+        uint64_t next()
+        {
+            state_ ^= state_ << 13;
+            state_ ^= state_ >> 7;
+            state_ ^= state_ << 17;
+            return state_;
+        }
+
+    private:
+        uint64_t state_;
+    };
+
+    /// @brief Prevents compiler from optimizing out computation of the value
+    template <typename T>
+    inline void do_not_optimize(T& value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        const volatile char* volatile sink = reinterpret_cast<const volatile char*>(&value);
+        static_cast<void>(sink);
+#endif
+    }
+
+    /// @brief Makes compiler to forget everything it knows about the value
+    template <typename T>
+    inline void clobber(T& value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : "+r,m"(value) : : "memory");
+#else
+        do_not_optimize(value);
+#endif
+    }
+}}
+
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+    /// @brief Set when benchmarks are built with C++17, which enables comparison with
+    /// std::variant and std::optional
+    #define EXL_BENCH_HAS_STD17 1
+#else
+    #define EXL_BENCH_HAS_STD17 0
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+    /// @brief Prevents inlining of the function, allows to measure the function call boundaries
+    #define EXL_BENCH_NOINLINE __attribute__((noinline))
+#elif defined(_MSC_VER)
+    #define EXL_BENCH_NOINLINE __declspec(noinline)
+#else
+    #define EXL_BENCH_NOINLINE
+#endif
+
+#define EXL_BENCH_CONCAT_IMPL(lhs, rhs) lhs##rhs
+#define EXL_BENCH_CONCAT(lhs, rhs) EXL_BENCH_CONCAT_IMPL(lhs, rhs)
+
+/// @brief Defines and registers benchmark function. Benchmark body receives `iterations` argument
+#define EXL_BENCHMARK(name)                                                                       \
+    static void EXL_BENCH_CONCAT(exl_benchmark_, __LINE__)(size_t iterations);                    \
+    static const bool EXL_BENCH_CONCAT(exl_benchmark_registered_, __LINE__) =                     \
+            ::exl::bench::register_benchmark(name, &EXL_BENCH_CONCAT(exl_benchmark_, __LINE__));  \
+    static void EXL_BENCH_CONCAT(exl_benchmark_, __LINE__)(size_t iterations)
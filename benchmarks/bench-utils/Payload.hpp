@@ -0,0 +1,89 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+#include "Benchmark.hpp"
+
+namespace exl { namespace bench
+{
+    /// @brief Trivially copyable payload of the specified size. Each Index produces distinct type
+    template <size_t Size>
+    struct TrivialPayload
+    {
+        template <size_t Index>
+        struct alternative
+        {
+            static constexpr size_t index = Index;
+
+            explicit alternative(size_t seed = 0)
+            {
+                std::memset(data, static_cast<int>(seed), Size);
+            }
+
+            int key() const
+            {
+                return data[0];
+            }
+
+            unsigned char data[Size];
+        };
+
+        static std::string name()
+        {
+            return "trivial" + std::to_string(Size);
+        }
+    };
+
+    /// @brief Payload with non-trivial copy and move (heap-allocated string)
+    struct StringPayload
+    {
+        template <size_t Index>
+        struct alternative
+        {
+            static constexpr size_t index = Index;
+
+            explicit alternative(size_t seed = 0)
+                : value(32, static_cast<char>('a' + seed % 26))
+            {}
+
+            int key() const
+            {
+                return value.empty() ? 0 : value[0];
+            }
+
+            std::string value;
+        };
+
+        static std::string name()
+        {
+            return "string";
+        }
+    };
+
+    /// @brief Non-inlined handler, distinct for each payload type (emulates real visitor work)
+    template <typename T>
+    EXL_BENCH_NOINLINE int handle(const T& value)
+    {
+        return value.key() ^ static_cast<int>(T::index);
+    }
+
+    /// @brief Generic functor which calls exl::bench::handle
+    struct Handler
+    {
+        template <typename T>
+        int operator()(const T& value) const
+        {
+            return handle(value);
+        }
+    };
+
+    /// @brief Count of the prepared values for the benchmarks. Power of two
+    constexpr size_t VALUES_COUNT = 1024;
+}}
@@ -0,0 +1,15 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <string>
+
+#include <Benchmark.hpp>
+
+int main(int argc, char** argv)
+{
+    // Optional first argument is used as benchmark name prefix filter
+    exl::bench::run_benchmarks(argc > 1 ? argv[1] : "");
+    return 0;
+}
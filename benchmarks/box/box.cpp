@@ -0,0 +1,128 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+// exl::box allocation and destruction compared with std::unique_ptr, allocator-aware exl::box
+// compared with the global heap
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <exl/box.hpp>
+
+#include <Benchmark.hpp>
+#include <Payload.hpp>
+
+namespace
+{
+    template <typename T>
+    void box_make_destroy(size_t iterations)
+    {
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            auto value = exl::box<T>::make(i);
+            exl::bench::do_not_optimize(value);
+        }
+    }
+
+    template <typename T>
+    void box_move(size_t iterations)
+    {
+        auto value = exl::box<T>::make(0);
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            auto moved = std::move(value);
+            exl::bench::do_not_optimize(moved);
+            value = std::move(moved);
+        }
+    }
+
+    template <typename T>
+    void box_allocate_make_destroy(size_t iterations)
+    {
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            auto value = exl::allocator_box<T, std::allocator<T>>::allocate_make(
+                    std::allocator<T>(),
+                    i
+            );
+            exl::bench::do_not_optimize(value);
+        }
+    }
+
+#if EXL_HAS_MEMORY_RESOURCE
+    template <typename T>
+    void pmr_box_make_destroy(size_t iterations)
+    {
+        std::pmr::unsynchronized_pool_resource resource;
+        const std::pmr::polymorphic_allocator<T> allocator(&resource);
+
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            auto value = exl::pmr::box<T>::allocate_make(allocator, i);
+            exl::bench::do_not_optimize(value);
+        }
+    }
+#endif
+
+    template <typename T>
+    void unique_ptr_make_destroy(size_t iterations)
+    {
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            std::unique_ptr<T> value(new T(i));
+            exl::bench::do_not_optimize(value);
+        }
+    }
+
+    template <typename T>
+    void unique_ptr_move(size_t iterations)
+    {
+        std::unique_ptr<T> value(new T(0));
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            auto moved = std::move(value);
+            exl::bench::do_not_optimize(moved);
+            value = std::move(moved);
+        }
+    }
+
+    template <typename Payload>
+    void register_sweep_point()
+    {
+        using T = typename Payload::template alternative<0>;
+        const std::string suffix = "payload:" + Payload::name();
+
+        exl::bench::register_benchmark("box/make_destroy/" + suffix, &box_make_destroy<T>);
+        exl::bench::register_benchmark("box/move/" + suffix, &box_move<T>);
+        exl::bench::register_benchmark(
+                "box/allocate_make_destroy/" + suffix,
+                &box_allocate_make_destroy<T>
+        );
+#if EXL_HAS_MEMORY_RESOURCE
+        exl::bench::register_benchmark(
+                "pmr::box/make_destroy/" + suffix,
+                &pmr_box_make_destroy<T>
+        );
+#endif
+        exl::bench::register_benchmark(
+                "std::unique_ptr/make_destroy/" + suffix,
+                &unique_ptr_make_destroy<T>
+        );
+        exl::bench::register_benchmark("std::unique_ptr/move/" + suffix, &unique_ptr_move<T>);
+    }
+
+    bool register_box_benchmarks()
+    {
+        register_sweep_point<exl::bench::TrivialPayload<8>>();
+        register_sweep_point<exl::bench::TrivialPayload<64>>();
+        register_sweep_point<exl::bench::TrivialPayload<256>>();
+        register_sweep_point<exl::bench::StringPayload>();
+        return true;
+    }
+
+    const bool registered = register_box_benchmarks();
+}
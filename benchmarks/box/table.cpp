@@ -0,0 +1,78 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+// Random lookups in the large table: exl::box<T[]> allocated with new[] compared with
+// exl::huge_page_box<T[]> backed by transparent huge pages
+
+#include <cstddef>
+#include <cstdint>
+
+#include <exl/box.hpp>
+
+#include <Benchmark.hpp>
+
+namespace
+{
+    // 256 MB table: far beyond the reach of the TLB with 4 KB pages
+    constexpr size_t table_size = size_t(64) * 1024 * 1024;
+
+    template <typename Table>
+    void fill(Table& table)
+    {
+        for (size_t i = 0; i < table_size; ++i)
+        {
+            table[i] = uint32_t(i * 2654435761u);
+        }
+    }
+
+    template <typename Table>
+    void lookup(const Table& table, size_t iterations)
+    {
+        exl::bench::Random random;
+        uint32_t sum = 0;
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            sum += table[static_cast<size_t>(random.next()) & (table_size - 1)];
+        }
+        exl::bench::do_not_optimize(sum);
+    }
+
+    // Tables are allocated and filled once, lookups are measured
+    exl::box<uint32_t[]>& heap_table()
+    {
+        static exl::box<uint32_t[]> table = exl::box<uint32_t[]>::make_array(table_size);
+        static bool filled = (fill(table), true);
+        static_cast<void>(filled);
+        return table;
+    }
+
+    exl::huge_page_box<uint32_t[]>& huge_page_table()
+    {
+        static exl::huge_page_box<uint32_t[]> table =
+                exl::huge_page_box<uint32_t[]>::make_array_huge_pages(table_size);
+        static bool filled = (fill(table), true);
+        static_cast<void>(filled);
+        return table;
+    }
+
+    void heap_lookup(size_t iterations)
+    {
+        lookup(heap_table(), iterations);
+    }
+
+    void huge_page_lookup(size_t iterations)
+    {
+        lookup(huge_page_table(), iterations);
+    }
+
+    bool register_table_benchmarks()
+    {
+        exl::bench::register_benchmark("box/table_lookup_256mb/new", &heap_lookup);
+        exl::bench::register_benchmark("box/table_lookup_256mb/huge_pages", &huge_page_lookup);
+        return true;
+    }
+
+    const bool registered = register_table_benchmarks();
+}
@@ -0,0 +1,131 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+// Matching over the range of 256K exl::mixed values with randomly distributed types: per-value
+// exl::mixed::match compared with the tag-partitioned exl::match_batch and exl::map_batch
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <exl/match_batch.hpp>
+#include <exl/mixed.hpp>
+
+#include <Benchmark.hpp>
+#include <Payload.hpp>
+
+namespace
+{
+    constexpr size_t VALUES_COUNT = 1 << 18;
+
+    using A = exl::bench::TrivialPayload<8>::alternative<0>;
+    using B = exl::bench::TrivialPayload<8>::alternative<1>;
+    using C = exl::bench::TrivialPayload<16>::alternative<2>;
+    using D = exl::bench::TrivialPayload<16>::alternative<3>;
+
+    using Mixed = exl::mixed<A, B, C, D>;
+
+    const std::vector<Mixed>& values()
+    {
+        static const std::vector<Mixed> result = []()
+        {
+            std::vector<Mixed> values;
+            values.reserve(VALUES_COUNT);
+
+            exl::bench::Random random;
+            for (size_t i = 0; i < VALUES_COUNT; ++i)
+            {
+                switch (random.next() & 3u)
+                {
+                    case 0: values.emplace_back(A(i)); break;
+                    case 1: values.emplace_back(B(i)); break;
+                    case 2: values.emplace_back(C(i)); break;
+                    default: values.emplace_back(D(i)); break;
+                }
+            }
+
+            return values;
+        }();
+
+        return result;
+    }
+}
+
+EXL_BENCHMARK("match_batch/sum/count:256K/per_value_match")
+{
+    const auto& range = values();
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        int64_t sum = 0;
+        for (const auto& value : range)
+        {
+            value.match(
+                    exl::when<A>([&sum](const A& v) { sum += v.key(); }),
+                    exl::when<B>([&sum](const B& v) { sum -= v.key(); }),
+                    exl::when<C>([&sum](const C& v) { sum += 2 * v.key(); }),
+                    exl::when<D>([&sum](const D& v) { sum -= 2 * v.key(); })
+            );
+        }
+        exl::bench::do_not_optimize(sum);
+    }
+}
+
+EXL_BENCHMARK("match_batch/sum/count:256K/match_batch")
+{
+    const auto& range = values();
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        int64_t sum = 0;
+        exl::match_batch(
+                range.begin(),
+                range.end(),
+                exl::when<A>([&sum](const A& v) { sum += v.key(); }),
+                exl::when<B>([&sum](const B& v) { sum -= v.key(); }),
+                exl::when<C>([&sum](const C& v) { sum += 2 * v.key(); }),
+                exl::when<D>([&sum](const D& v) { sum -= 2 * v.key(); })
+        );
+        exl::bench::do_not_optimize(sum);
+    }
+}
+
+EXL_BENCHMARK("match_batch/map/count:256K/per_value_map")
+{
+    const auto& range = values();
+    std::vector<int> results(range.size());
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        for (size_t j = 0; j < range.size(); ++j)
+        {
+            results[j] = range[j].map<int>(
+                    exl::when<A>([](const A& v) { return v.key(); }),
+                    exl::when<B>([](const B& v) { return -v.key(); }),
+                    exl::when<C>([](const C& v) { return 2 * v.key(); }),
+                    exl::when<D>([](const D& v) { return -2 * v.key(); })
+            );
+        }
+        auto data = results.data();
+        exl::bench::do_not_optimize(data);
+    }
+}
+
+EXL_BENCHMARK("match_batch/map/count:256K/map_batch")
+{
+    const auto& range = values();
+    std::vector<int> results(range.size());
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        exl::map_batch<int>(
+                range.begin(),
+                range.end(),
+                results.begin(),
+                exl::when<A>([](const A& v) { return v.key(); }),
+                exl::when<B>([](const B& v) { return -v.key(); }),
+                exl::when<C>([](const C& v) { return 2 * v.key(); }),
+                exl::when<D>([](const D& v) { return -2 * v.key(); })
+        );
+        auto data = results.data();
+        exl::bench::do_not_optimize(data);
+    }
+}
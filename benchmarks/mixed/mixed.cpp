@@ -0,0 +1,376 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+// exl::mixed operations compared with std::variant. Sweeps over alternatives count and payload.
+// Values for the copy/move/assign/map benchmarks hold random alternatives
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <exl/box.hpp>
+#include <exl/mixed.hpp>
+#include <exl/relocate.hpp>
+#include <exl/impl/mixed/index_sequence.hpp>
+
+#include <Benchmark.hpp>
+#include <Payload.hpp>
+
+#if EXL_BENCH_HAS_STD17
+    #include <variant>
+#endif
+
+namespace
+{
+    using exl::bench::VALUES_COUNT;
+
+    struct Extra
+    {
+        int value;
+    };
+
+    template <
+            typename Payload,
+            size_t Count,
+            typename Indices = exl::impl::make_index_sequence<Count>
+    >
+    struct MixedTypes;
+
+    template <typename Payload, size_t Count, size_t ... Indices>
+    struct MixedTypes<Payload, Count, exl::impl::index_sequence<Indices...>>
+    {
+        template <size_t Index>
+        using alternative_t = typename Payload::template alternative<Index>;
+
+        using exl_t = exl::mixed<alternative_t<Indices>...>;
+        using superset_t = exl::mixed<Extra, alternative_t<Indices>...>;
+
+        static exl_t make_exl(size_t index, size_t seed)
+        {
+            using Factory = exl_t (*)(size_t);
+            static const Factory factories[] = { &make_exl_as<Indices>... };
+            return factories[index](seed);
+        }
+
+        static int map_exl(const exl_t& value)
+        {
+            return value.template map<int>(
+                    exl::when_exact<alternative_t<Indices>>(exl::bench::Handler())...
+            );
+        }
+
+#if EXL_BENCH_HAS_STD17
+        using std_t = std::variant<alternative_t<Indices>...>;
+
+        static std_t make_std(size_t index, size_t seed)
+        {
+            using Factory = std_t (*)(size_t);
+            static const Factory factories[] = { &make_std_as<Indices>... };
+            return factories[index](seed);
+        }
+
+        static int map_std(const std_t& value)
+        {
+            return std::visit(exl::bench::Handler(), value);
+        }
+#endif
+
+    private:
+        template <size_t Index>
+        static exl_t make_exl_as(size_t seed)
+        {
+            return exl_t(alternative_t<Index>(seed));
+        }
+
+#if EXL_BENCH_HAS_STD17
+        template <size_t Index>
+        static std_t make_std_as(size_t seed)
+        {
+            return std_t(alternative_t<Index>(seed));
+        }
+#endif
+    };
+
+    // Generic benchmark bodies, parametrized with the value type operations
+    template <typename Ops>
+    struct MixedBenchmarks
+    {
+        using value_t = typename Ops::value_t;
+
+        static std::vector<value_t>& values()
+        {
+            static std::vector<value_t> prepared = prepare();
+            return prepared;
+        }
+
+        static void construct(size_t iterations)
+        {
+            for (size_t i = 0; i < iterations; ++i)
+            {
+                value_t value = Ops::construct(i);
+                exl::bench::do_not_optimize(value);
+            }
+        }
+
+        static void copy(size_t iterations)
+        {
+            auto& source = values();
+            for (size_t i = 0; i < iterations; ++i)
+            {
+                value_t value(source[i & (VALUES_COUNT - 1)]);
+                exl::bench::do_not_optimize(value);
+            }
+        }
+
+        // Round-trip move keeps the prepared values intact: value is moved out and moved back
+        static void move(size_t iterations)
+        {
+            auto& source = values();
+            for (size_t i = 0; i < iterations; ++i)
+            {
+                auto& item = source[i & (VALUES_COUNT - 1)];
+                value_t value(std::move(item));
+                exl::bench::do_not_optimize(value);
+                item = std::move(value);
+            }
+        }
+
+        static void copy_assign(size_t iterations)
+        {
+            auto& source = values();
+            value_t value = Ops::construct(0);
+            for (size_t i = 0; i < iterations; ++i)
+            {
+                value = source[i & (VALUES_COUNT - 1)];
+                exl::bench::do_not_optimize(value);
+            }
+        }
+
+        static void map(size_t iterations)
+        {
+            auto& source = values();
+            int sum = 0;
+            for (size_t i = 0; i < iterations; ++i)
+            {
+                sum += Ops::map(source[i & (VALUES_COUNT - 1)]);
+            }
+            exl::bench::do_not_optimize(sum);
+        }
+
+    private:
+        static std::vector<value_t> prepare()
+        {
+            exl::bench::Random random;
+            std::vector<value_t> prepared;
+            prepared.reserve(VALUES_COUNT);
+            for (size_t i = 0; i < VALUES_COUNT; ++i)
+            {
+                prepared.push_back(Ops::make(static_cast<size_t>(random.next() % Ops::COUNT), i));
+            }
+            return prepared;
+        }
+    };
+
+    template <typename Payload, size_t Count>
+    struct ExlOps
+    {
+        using types_t = MixedTypes<Payload, Count>;
+        using value_t = typename types_t::exl_t;
+        static constexpr size_t COUNT = Count;
+
+        static value_t make(size_t index, size_t seed) { return types_t::make_exl(index, seed); }
+        static value_t construct(size_t seed) { return types_t::make_exl(Count - 1, seed); }
+        static int map(const value_t& value) { return types_t::map_exl(value); }
+    };
+
+    template <typename Payload, size_t Count>
+    void convert_assign(size_t iterations)
+    {
+        using Benchmarks = MixedBenchmarks<ExlOps<Payload, Count>>;
+        using superset_t = typename MixedTypes<Payload, Count>::superset_t;
+
+        auto& source = Benchmarks::values();
+        superset_t value = Extra { 0 };
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            value = source[i & (VALUES_COUNT - 1)];
+            exl::bench::do_not_optimize(value);
+        }
+    }
+
+#if EXL_BENCH_HAS_STD17
+    template <typename Payload, size_t Count>
+    struct StdOps
+    {
+        using types_t = MixedTypes<Payload, Count>;
+        using value_t = typename types_t::std_t;
+        static constexpr size_t COUNT = Count;
+
+        static value_t make(size_t index, size_t seed) { return types_t::make_std(index, seed); }
+        static value_t construct(size_t seed) { return types_t::make_std(Count - 1, seed); }
+        static int map(const value_t& value) { return types_t::map_std(value); }
+    };
+#endif
+
+    // Extraction of the heap-allocated payload (e.g. response body) from the message: const map
+    // copies the payload, map of the rvalue moves it out
+    using Message = exl::mixed<int, std::string>;
+
+    template <bool Move>
+    void extract_payload(size_t iterations)
+    {
+        const std::string body(256, 'b');
+
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            Message message(body);
+            exl::bench::clobber(message);
+
+            std::string extracted = Move
+                    ? std::move(message).map<std::string>(
+                            exl::when<std::string>([](std::string&& v) { return std::move(v); }),
+                            exl::otherwise([]() { return std::string(); }))
+                    : message.map<std::string>(
+                            exl::when<std::string>([](const std::string& v) { return v; }),
+                            exl::otherwise([]() { return std::string(); }));
+            exl::bench::do_not_optimize(extracted);
+        }
+    }
+
+    // Swap and relocation (e.g. on the vector growth) of the values which own heap payloads:
+    // generic moves compared with the bytewise exl::mixed::swap and exl::relocate, which are
+    // allowed for the trivially relocatable exl::mixed
+    using Owned = exl::mixed<int, exl::box<std::string>>;
+    constexpr size_t RELOCATE_COUNT = 1024;
+
+    template <bool Member>
+    void swap_owned(size_t iterations)
+    {
+        std::vector<Owned> values;
+        exl::bench::Random random;
+        for (size_t i = 0; i < VALUES_COUNT; ++i)
+        {
+            values.push_back((random.next() & 1u) == 0
+                    ? Owned(exl::box<std::string>::make("payload"))
+                    : Owned(static_cast<int>(i)));
+        }
+
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            auto& lhs = values[i & (VALUES_COUNT - 1)];
+            auto& rhs = values[(i * 7 + 3) & (VALUES_COUNT - 1)];
+
+            if (Member)
+            {
+                lhs.swap(rhs);
+            }
+            else
+            {
+                Owned tmp(std::move(lhs));
+                lhs = std::move(rhs);
+                rhs = std::move(tmp);
+            }
+            exl::bench::clobber(lhs);
+        }
+    }
+
+    void relocate_by_move(Owned* first, Owned* last, Owned* dest)
+    {
+        for (; first != last; ++first, ++dest)
+        {
+            new(dest) Owned(std::move(*first));
+            first->~Owned();
+        }
+    }
+
+    template <bool Relocate>
+    void relocate_owned(size_t iterations)
+    {
+        std::vector<unsigned char> buffers(2 * RELOCATE_COUNT * sizeof(Owned));
+        auto src = reinterpret_cast<Owned*>(buffers.data());
+        auto dest = src + RELOCATE_COUNT;
+
+        for (size_t i = 0; i < RELOCATE_COUNT; ++i)
+        {
+            new(src + i) Owned(static_cast<int>(i));
+        }
+        new(src) Owned(exl::box<std::string>::make("payload"));
+
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            if (Relocate)
+            {
+                exl::relocate(src, src + RELOCATE_COUNT, dest);
+            }
+            else
+            {
+                relocate_by_move(src, src + RELOCATE_COUNT, dest);
+            }
+            std::swap(src, dest);
+            exl::bench::clobber(*src);
+        }
+
+        for (size_t i = 0; i < RELOCATE_COUNT; ++i)
+        {
+            src[i].~Owned();
+        }
+    }
+
+    template <typename Ops>
+    void register_common(const std::string& prefix, const std::string& suffix)
+    {
+        using Benchmarks = MixedBenchmarks<Ops>;
+
+        exl::bench::register_benchmark(prefix + "/construct/" + suffix, &Benchmarks::construct);
+        exl::bench::register_benchmark(prefix + "/copy/" + suffix, &Benchmarks::copy);
+        exl::bench::register_benchmark(prefix + "/move/" + suffix, &Benchmarks::move);
+        exl::bench::register_benchmark(prefix + "/copy_assign/" + suffix, &Benchmarks::copy_assign);
+        exl::bench::register_benchmark(prefix + "/map/" + suffix, &Benchmarks::map);
+    }
+
+    template <typename Payload, size_t Count>
+    void register_sweep_point()
+    {
+        const std::string suffix = "alternatives:" + std::to_string(Count)
+                + "/payload:" + Payload::name();
+
+        register_common<ExlOps<Payload, Count>>("mixed", suffix);
+        exl::bench::register_benchmark(
+                "mixed/convert_assign/" + suffix,
+                &convert_assign<Payload, Count>
+        );
+
+#if EXL_BENCH_HAS_STD17
+        register_common<StdOps<Payload, Count>>("std::variant", suffix);
+#endif
+    }
+
+    template <typename Payload>
+    void register_payload_sweep()
+    {
+        register_sweep_point<Payload, 2>();
+        register_sweep_point<Payload, 8>();
+        register_sweep_point<Payload, 32>();
+    }
+
+    bool register_mixed_benchmarks()
+    {
+        register_payload_sweep<exl::bench::TrivialPayload<8>>();
+        register_payload_sweep<exl::bench::TrivialPayload<64>>();
+        register_payload_sweep<exl::bench::TrivialPayload<256>>();
+        register_payload_sweep<exl::bench::StringPayload>();
+
+        exl::bench::register_benchmark("mixed/extract_payload/copy", &extract_payload<false>);
+        exl::bench::register_benchmark("mixed/extract_payload/move", &extract_payload<true>);
+        exl::bench::register_benchmark("mixed/swap/moves", &swap_owned<false>);
+        exl::bench::register_benchmark("mixed/swap/member", &swap_owned<true>);
+        exl::bench::register_benchmark("mixed/relocate/count:1024/moves", &relocate_owned<false>);
+        exl::bench::register_benchmark("mixed/relocate/count:1024/relocate", &relocate_owned<true>);
+        return true;
+    }
+
+    const bool registered = register_mixed_benchmarks();
+}
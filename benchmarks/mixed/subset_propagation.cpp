@@ -0,0 +1,147 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+// Error propagation through 5 call stack layers: each layer may fail with its own error type
+// and otherwise converts result of the lower layer to its own (superset) exl::mixed type
+
+#include <cstddef>
+
+#include <exl/mixed.hpp>
+
+#include <Benchmark.hpp>
+
+namespace
+{
+    constexpr int LAYERS = 5;
+
+    template <int Layer>
+    struct Error
+    {
+        int code;
+    };
+
+    template <typename T, typename Mixed>
+    struct prepend_alternative;
+
+    template <typename T, typename ... Types>
+    struct prepend_alternative<T, exl::mixed<Types...>>
+    {
+        using type = exl::mixed<T, Types...>;
+    };
+
+    template <int N>
+    struct layer_result
+    {
+        using type = typename prepend_alternative<
+                Error<N>,
+                typename layer_result<N - 1>::type
+        >::type;
+    };
+
+    template <>
+    struct layer_result<0>
+    {
+        using type = exl::mixed<int, Error<0>>;
+    };
+
+    /// Layer N result: exl::mixed<Error<N>, ..., Error<1>, int, Error<0>>
+    template <int N>
+    using Layer = typename layer_result<N>::type;
+
+    // Each layer fails with probability of 1/4 (for the random input)
+    template <int N>
+    bool layer_fails(size_t input)
+    {
+        return ((input >> (2 * N)) & 3u) == 0;
+    }
+
+    template <int N>
+    EXL_BENCH_NOINLINE Layer<N> propagate(size_t input)
+    {
+        if (layer_fails<N>(input))
+        {
+            return Error<N> { N };
+        }
+
+        return propagate<N - 1>(input);
+    }
+
+    template <>
+    EXL_BENCH_NOINLINE Layer<0> propagate<0>(size_t input)
+    {
+        if (layer_fails<0>(input))
+        {
+            return Error<0> { 0 };
+        }
+
+        return static_cast<int>(input);
+    }
+
+    template <int N>
+    EXL_BENCH_NOINLINE void propagate_assign(Layer<N>& result, size_t input)
+    {
+        if (layer_fails<N>(input))
+        {
+            result = Error<N> { N };
+            return;
+        }
+
+        Layer<N - 1> lower = Error<N - 1> { 0 };
+        propagate_assign<N - 1>(lower, input);
+        result = lower;
+    }
+
+    template <>
+    EXL_BENCH_NOINLINE void propagate_assign<0>(Layer<0>& result, size_t input)
+    {
+        if (layer_fails<0>(input))
+        {
+            result = Error<0> { 0 };
+            return;
+        }
+
+        result = static_cast<int>(input);
+    }
+}
+
+EXL_BENCHMARK("mixed/subset_propagation/construct/layers:5/sequential")
+{
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        auto result = propagate<LAYERS>(i);
+        exl::bench::do_not_optimize(result);
+    }
+}
+
+EXL_BENCHMARK("mixed/subset_propagation/construct/layers:5/random")
+{
+    exl::bench::Random random;
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        auto result = propagate<LAYERS>(random.next());
+        exl::bench::do_not_optimize(result);
+    }
+}
+
+EXL_BENCHMARK("mixed/subset_propagation/assign/layers:5/sequential")
+{
+    Layer<LAYERS> result = Error<LAYERS> { 0 };
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        propagate_assign<LAYERS>(result, i);
+        exl::bench::do_not_optimize(result);
+    }
+}
+
+EXL_BENCHMARK("mixed/subset_propagation/assign/layers:5/random")
+{
+    exl::bench::Random random;
+    Layer<LAYERS> result = Error<LAYERS> { 0 };
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        propagate_assign<LAYERS>(result, random.next());
+        exl::bench::do_not_optimize(result);
+    }
+}
@@ -0,0 +1,150 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+// Scans over the event store of 256K events: exl::mixed_vector compared with std::vector of
+// exl::mixed. Events are of three types with sizes from 8 to 256 bytes, one of 8 events is small
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <exl/mixed.hpp>
+#include <exl/mixed_vector.hpp>
+
+#include <Benchmark.hpp>
+#include <Payload.hpp>
+
+namespace
+{
+    constexpr size_t EVENTS_COUNT = 1 << 18;
+
+    using Small = exl::bench::TrivialPayload<8>::alternative<0>;
+    using Medium = exl::bench::TrivialPayload<64>::alternative<1>;
+    using Large = exl::bench::TrivialPayload<256>::alternative<2>;
+
+    using Mixed = exl::mixed<Small, Medium, Large>;
+    using MixedVector = exl::mixed_vector<Small, Medium, Large>;
+
+    template <typename Push>
+    void fill(Push&& push)
+    {
+        exl::bench::Random random;
+        for (size_t i = 0; i < EVENTS_COUNT; ++i)
+        {
+            const auto kind = random.next() & 7u;
+            if (kind == 0)
+            {
+                push(Mixed(Small(i)));
+            }
+            else if (kind < 4)
+            {
+                push(Mixed(Medium(i)));
+            }
+            else
+            {
+                push(Mixed(Large(i)));
+            }
+        }
+    }
+
+    const std::vector<Mixed>& array_of_mixed()
+    {
+        static const std::vector<Mixed> events = []()
+        {
+            std::vector<Mixed> result;
+            fill([&result](Mixed&& value) { result.push_back(std::move(value)); });
+            return result;
+        }();
+
+        return events;
+    }
+
+    const MixedVector& mixed_vector()
+    {
+        static const MixedVector events = []()
+        {
+            MixedVector result;
+            fill([&result](Mixed&& value)
+            {
+                value.match(
+                        exl::when<Small>([&result](const Small& v) { result.push_back(v); }),
+                        exl::when<Medium>([&result](const Medium& v) { result.push_back(v); }),
+                        exl::when<Large>([&result](const Large& v) { result.push_back(v); })
+                );
+            });
+            return result;
+        }();
+
+        return events;
+    }
+}
+
+EXL_BENCHMARK("mixed_vector/scan_of_type/count:256K/vector_of_mixed")
+{
+    const auto& events = array_of_mixed();
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        int sum = 0;
+        for (const auto& event : events)
+        {
+            if (event.is_exact<Small>())
+            {
+                sum += event.unwrap_exact<Small>().key();
+            }
+        }
+        exl::bench::do_not_optimize(sum);
+    }
+}
+
+EXL_BENCHMARK("mixed_vector/scan_of_type/count:256K/mixed_vector")
+{
+    const auto& events = mixed_vector();
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        int sum = 0;
+        events.for_each_of<Small>([&sum](const Small& event) { sum += event.key(); });
+        exl::bench::do_not_optimize(sum);
+    }
+}
+
+EXL_BENCHMARK("mixed_vector/count/count:256K/vector_of_mixed")
+{
+    const auto& events = array_of_mixed();
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        size_t count = 0;
+        for (const auto& event : events)
+        {
+            count += size_t(event.is<Medium>() || event.is<Small>());
+        }
+        exl::bench::do_not_optimize(count);
+    }
+}
+
+EXL_BENCHMARK("mixed_vector/count/count:256K/mixed_vector")
+{
+    const auto& events = mixed_vector();
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        size_t count = events.count_exact<Medium>(0, events.size())
+                + events.count_exact<Small>(0, events.size());
+        exl::bench::do_not_optimize(count);
+    }
+}
+
+EXL_BENCHMARK("mixed_vector/find/count:256K/mixed_vector")
+{
+    const auto& events = mixed_vector();
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        size_t found = 0;
+        for (size_t position = events.find_exact<Small>(); position != events.size();
+             position = events.find_exact<Small>(position + 1))
+        {
+            ++found;
+        }
+        exl::bench::do_not_optimize(found);
+    }
+}
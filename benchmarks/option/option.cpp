@@ -0,0 +1,175 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+// exl::option operations compared with std::optional. Half of the prepared values are empty
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <exl/option.hpp>
+
+#include <Benchmark.hpp>
+#include <Payload.hpp>
+
+#if EXL_BENCH_HAS_STD17
+    #include <optional>
+#endif
+
+namespace
+{
+    using exl::bench::VALUES_COUNT;
+
+    template <typename T>
+    T make_value(size_t seed)
+    {
+        return T(seed);
+    }
+
+    template <>
+    int* make_value<int*>(size_t seed)
+    {
+        static int storage[VALUES_COUNT];
+        return &storage[seed & (VALUES_COUNT - 1)];
+    }
+
+    template <typename T>
+    int key_of(const T& value)
+    {
+        return value.key();
+    }
+
+    int key_of(const uint64_t& value)
+    {
+        return static_cast<int>(value);
+    }
+
+    int key_of(int* const& value)
+    {
+        return *value;
+    }
+
+    template <typename T>
+    struct ExlOps
+    {
+        using value_t = exl::option<T>;
+
+        static value_t some(size_t seed) { return value_t(make_value<T>(seed)); }
+        static value_t none() { return value_t(exl::none()); }
+
+        static int key_or_zero(const value_t& value)
+        {
+            return value.is_some() ? key_of(value.unwrap_some()) : 0;
+        }
+    };
+
+#if EXL_BENCH_HAS_STD17
+    template <typename T>
+    struct StdOps
+    {
+        using value_t = std::optional<T>;
+
+        static value_t some(size_t seed) { return value_t(make_value<T>(seed)); }
+        static value_t none() { return value_t(std::nullopt); }
+
+        static int key_or_zero(const value_t& value)
+        {
+            return value.has_value() ? key_of(*value) : 0;
+        }
+    };
+#endif
+
+    template <typename Ops>
+    struct OptionBenchmarks
+    {
+        using value_t = typename Ops::value_t;
+
+        static std::vector<value_t>& values()
+        {
+            static std::vector<value_t> prepared = prepare();
+            return prepared;
+        }
+
+        static void copy(size_t iterations)
+        {
+            auto& source = values();
+            for (size_t i = 0; i < iterations; ++i)
+            {
+                value_t value(source[i & (VALUES_COUNT - 1)]);
+                exl::bench::do_not_optimize(value);
+            }
+        }
+
+        static void assign(size_t iterations)
+        {
+            auto& source = values();
+            value_t value = Ops::none();
+            for (size_t i = 0; i < iterations; ++i)
+            {
+                value = source[i & (VALUES_COUNT - 1)];
+                exl::bench::do_not_optimize(value);
+            }
+        }
+
+        static void check_unwrap(size_t iterations)
+        {
+            auto& source = values();
+            int sum = 0;
+            for (size_t i = 0; i < iterations; ++i)
+            {
+                sum += Ops::key_or_zero(source[i & (VALUES_COUNT - 1)]);
+            }
+            exl::bench::do_not_optimize(sum);
+        }
+
+    private:
+        static std::vector<value_t> prepare()
+        {
+            exl::bench::Random random;
+            std::vector<value_t> prepared;
+            prepared.reserve(VALUES_COUNT);
+            for (size_t i = 0; i < VALUES_COUNT; ++i)
+            {
+                prepared.push_back((random.next() & 1u) ? Ops::some(i) : Ops::none());
+            }
+            return prepared;
+        }
+    };
+
+    template <typename Ops>
+    void register_option_benchmarks(const std::string& prefix, const std::string& suffix)
+    {
+        using Benchmarks = OptionBenchmarks<Ops>;
+
+        exl::bench::register_benchmark(prefix + "/copy/" + suffix, &Benchmarks::copy);
+        exl::bench::register_benchmark(prefix + "/assign/" + suffix, &Benchmarks::assign);
+        exl::bench::register_benchmark(
+                prefix + "/check_unwrap/" + suffix,
+                &Benchmarks::check_unwrap
+        );
+    }
+
+    template <typename T>
+    void register_sweep_point(const std::string& payload)
+    {
+        register_option_benchmarks<ExlOps<T>>("option", "payload:" + payload);
+#if EXL_BENCH_HAS_STD17
+        register_option_benchmarks<StdOps<T>>("std::optional", "payload:" + payload);
+#endif
+    }
+
+    bool register_all_option_benchmarks()
+    {
+        register_sweep_point<uint64_t>("uint64");
+        register_sweep_point<int*>("pointer");
+        register_sweep_point<exl::bench::TrivialPayload<64>::alternative<0>>("trivial64");
+        register_sweep_point<exl::bench::TrivialPayload<256>::alternative<0>>("trivial256");
+        register_sweep_point<exl::bench::StringPayload::alternative<0>>("string");
+        return true;
+    }
+
+    const bool registered = register_all_option_benchmarks();
+}
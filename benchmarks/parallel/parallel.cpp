@@ -0,0 +1,127 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+// Transform of 1M exl::mixed values to exl::result: single-threaded exl::map_batch compared with
+// exl::parallel_transform on the pool which occupies all hardware threads. Speedup is bounded
+// by the hardware threads count of the benchmark host
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <exl/match_batch.hpp>
+#include <exl/parallel.hpp>
+#include <exl/result.hpp>
+
+#include <Benchmark.hpp>
+#include <Payload.hpp>
+
+namespace
+{
+    constexpr size_t VALUES_COUNT = 1 << 20;
+
+    using Sample = exl::bench::TrivialPayload<8>::alternative<0>;
+    using Packet = exl::bench::TrivialPayload<32>::alternative<1>;
+
+    struct Corrupted
+    {
+        int key;
+    };
+
+    using Mixed = exl::mixed<Sample, Packet>;
+    using Output = exl::result<int, Corrupted>;
+
+    const std::vector<Mixed>& values()
+    {
+        static const std::vector<Mixed> result = []()
+        {
+            std::vector<Mixed> values;
+            values.reserve(VALUES_COUNT);
+
+            exl::bench::Random random;
+            for (size_t i = 0; i < VALUES_COUNT; ++i)
+            {
+                if ((random.next() & 1u) == 0)
+                {
+                    values.emplace_back(Sample(i));
+                }
+                else
+                {
+                    values.emplace_back(Packet(i));
+                }
+            }
+
+            return values;
+        }();
+
+        return result;
+    }
+
+    exl::thread_pool& pool()
+    {
+        static exl::thread_pool instance;
+        return instance;
+    }
+
+    // Few dozens of cycles of work per value
+    int checksum(int key)
+    {
+        auto state = static_cast<uint32_t>(key);
+        for (int i = 0; i < 16; ++i)
+        {
+            state = state * 1664525u + 1013904223u;
+        }
+
+        return static_cast<int>(state >> 1);
+    }
+
+    Output process_sample(const Sample& sample)
+    {
+        return Output(checksum(sample.key()));
+    }
+
+    Output process_packet(const Packet& packet)
+    {
+        const auto sum = checksum(packet.key());
+        return (sum & 0xFF) == 0 ? Output(Corrupted { packet.key() }) : Output(sum);
+    }
+}
+
+EXL_BENCHMARK("parallel/transform/count:1M/map_batch")
+{
+    const auto& range = values();
+    std::vector<Output> results(range.size(), Output(0));
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        exl::map_batch<Output>(
+                range.begin(),
+                range.end(),
+                results.begin(),
+                exl::when<Sample>(&process_sample),
+                exl::when<Packet>(&process_packet)
+        );
+        auto data = results.data();
+        exl::bench::do_not_optimize(data);
+    }
+}
+
+EXL_BENCHMARK("parallel/transform/count:1M/parallel_transform")
+{
+    const auto& range = values();
+    std::vector<Output> results(range.size(), Output(0));
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        exl::parallel_transform<Output>(
+                pool(),
+                range.begin(),
+                range.end(),
+                results.begin(),
+                exl::when<Sample>(&process_sample),
+                exl::when<Packet>(&process_packet)
+        );
+        auto data = results.data();
+        exl::bench::do_not_optimize(data);
+    }
+}
@@ -0,0 +1,76 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+// Allocation and destruction of the hot fixed-size values: exl::box allocated from the heap
+// compared with exl::pool_box recycled by exl::pool
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <exl/box.hpp>
+#include <exl/pool.hpp>
+
+#include <Benchmark.hpp>
+#include <Payload.hpp>
+
+namespace
+{
+    constexpr size_t live_values = 64;
+
+    template <typename T>
+    void box_make_destroy(size_t iterations)
+    {
+        std::vector<exl::box<T>> values;
+        for (size_t i = 0; i < live_values; ++i)
+        {
+            values.emplace_back(nullptr);
+        }
+
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            values[i % live_values] = exl::box<T>::make(i);
+        }
+        exl::bench::do_not_optimize(values);
+    }
+
+    template <typename T>
+    void pool_make_destroy(size_t iterations)
+    {
+        exl::pool<T> pool;
+
+        std::vector<exl::pool_box<T>> values;
+        for (size_t i = 0; i < live_values; ++i)
+        {
+            values.emplace_back(nullptr);
+        }
+
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            values[i % live_values] = pool.make(i);
+        }
+        exl::bench::do_not_optimize(values);
+    }
+
+    template <typename Payload>
+    void register_sweep_point()
+    {
+        using T = typename Payload::template alternative<0>;
+        const std::string suffix = "payload:" + Payload::name();
+
+        exl::bench::register_benchmark("pool/box/" + suffix, &box_make_destroy<T>);
+        exl::bench::register_benchmark("pool/pool_box/" + suffix, &pool_make_destroy<T>);
+    }
+
+    bool register_pool_benchmarks()
+    {
+        register_sweep_point<exl::bench::TrivialPayload<8>>();
+        register_sweep_point<exl::bench::TrivialPayload<64>>();
+        register_sweep_point<exl::bench::TrivialPayload<256>>();
+        return true;
+    }
+
+    const bool registered = register_pool_benchmarks();
+}
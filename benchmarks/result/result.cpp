@@ -0,0 +1,130 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+// Return of the fallible function result through the call boundary: exl::result compared with
+// plain exl::mixed of the value and errors. One of 1024 calls fails
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <exl/mixed.hpp>
+#include <exl/result.hpp>
+
+#include <Benchmark.hpp>
+
+namespace
+{
+    struct ParseError
+    {
+        ParseError(std::string what, uint64_t position)
+                : what(std::move(what))
+                , position(position) {}
+
+        std::string what;
+        uint64_t position;
+    };
+
+    struct IoError
+    {
+        explicit IoError(int code)
+                : code(code) {}
+
+        int code;
+        char path[60];
+    };
+
+    using Mixed = exl::mixed<uint64_t, ParseError, IoError>;
+    using Result = exl::result<uint64_t, ParseError, IoError>;
+
+    template <typename R>
+    EXL_BENCH_NOINLINE R parse(uint64_t input)
+    {
+        if ((input & 1023u) == 0)
+        {
+            return R(ParseError("unexpected input", input));
+        }
+
+        return R(input * 3);
+    }
+
+    template <typename R>
+    uint64_t value_or_zero(const R& r);
+
+    template <>
+    uint64_t value_or_zero<Mixed>(const Mixed& r)
+    {
+        return r.is_exact<uint64_t>() ? r.unwrap_exact<uint64_t>() : 0;
+    }
+
+    template <>
+    uint64_t value_or_zero<Result>(const Result& r)
+    {
+        return r.is_ok() ? r.unwrap_ok() : 0;
+    }
+
+    template <typename R>
+    void return_mostly_ok(size_t iterations)
+    {
+        uint64_t sum = 0;
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            sum += value_or_zero(parse<R>(i + 1));
+        }
+        exl::bench::do_not_optimize(sum);
+    }
+
+    // Propagation of the error with EXL_TRY to the caller: error types of the callee are the
+    // trailing error types of the caller (tag and storage are moved as is) or are reordered
+    // (error is converted by dispatch on its type). One of 4 calls fails
+    using ReadResult = exl::result<uint64_t, IoError, ParseError>;
+    using SuffixResult = exl::result<uint64_t, int, IoError, ParseError>;
+    using ReorderedResult = exl::result<uint64_t, ParseError, int, IoError>;
+
+    EXL_BENCH_NOINLINE ReadResult read(uint64_t input)
+    {
+        if ((input & 3u) == 0)
+        {
+            return ReadResult(IoError(static_cast<int>(input)));
+        }
+
+        return ReadResult(input);
+    }
+
+    template <typename R>
+    EXL_BENCH_NOINLINE R read_twice(uint64_t input)
+    {
+        EXL_TRY(uint64_t value, read(input));
+        return R(value * 2);
+    }
+
+    template <typename R>
+    void propagate_error(size_t iterations)
+    {
+        exl::bench::Random random;
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            auto r = read_twice<R>(random.next());
+            exl::bench::do_not_optimize(r);
+        }
+    }
+
+    bool register_all_result_benchmarks()
+    {
+        exl::bench::register_benchmark("result/return_mostly_ok", &return_mostly_ok<Result>);
+        exl::bench::register_benchmark("mixed/return_mostly_ok", &return_mostly_ok<Mixed>);
+        exl::bench::register_benchmark(
+                "result/propagate_error/suffix",
+                &propagate_error<SuffixResult>
+        );
+        exl::bench::register_benchmark(
+                "result/propagate_error/reordered",
+                &propagate_error<ReorderedResult>
+        );
+        return true;
+    }
+
+    const bool registered = register_all_result_benchmarks();
+}
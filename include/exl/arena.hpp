@@ -0,0 +1,280 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <exl/box.hpp>
+#include <exl/result.hpp>
+
+#include <exl/details/box/arena_deleter.hpp>
+
+#include <exl/impl/hints.hpp>
+
+namespace exl
+{
+    /// @brief exl::box of the value allocated from exl::arena
+    template <typename T>
+    using arena_box = box<T, arena_deleter<T>>;
+
+    /// @brief Error of exl::arena::try_make: arena has no memory left for the value
+    struct arena_exhausted {};
+
+    /// @brief Exception-free bump allocator for the groups of objects with the common lifetime
+    /// (e.g. object graph built for the single request).
+    ///
+    /// Values are allocated by advancing the pointer in the current memory block. Boxes created
+    /// by exl::arena::make only destroy their values, memory of all values is reclaimed at once
+    /// by exl::arena::reset or by the arena destructor, so teardown of the large graph costs
+    /// only destructor calls. Growing arena allocates blocks of increasing size from the heap,
+    /// fixed arena allocates only from the buffer provided by the user. Exhaustion is reported
+    /// as the invalid box (or arena_exhausted error of exl::arena::try_make).
+    /// ```
+    /// exl::arena arena;
+    /// for (const auto& request : requests)
+    /// {
+    ///     {
+    ///         auto root = arena.make<Node>(request.key);
+    ///         root->left = arena.make<Node>(request.leftKey);
+    ///         process(*root);
+    ///     } // nodes are destroyed, their memory stays in the arena
+    ///     arena.reset();
+    /// }
+    /// ```
+    ///
+    /// @warning All boxes of the arena should be destroyed before exl::arena::reset and before
+    /// the arena destruction. Arena is not thread-safe.
+    class arena
+    {
+    public:
+        /// @brief Size of the first heap block of the growing arena
+        static constexpr size_t default_block_size()
+        {
+            return 4096;
+        }
+
+    public:
+        /// @brief Creates growing arena. Memory is allocated on the first allocation, each next
+        /// heap block is twice as large as the previous one
+        explicit arena(size_t initialBlockSize = default_block_size()) noexcept
+                : blocks_(nullptr)
+                , current_(nullptr)
+                , end_(nullptr)
+                , buffer_(nullptr)
+                , bufferEnd_(nullptr)
+                , nextBlockSize_(initialBlockSize != 0 ? initialBlockSize : default_block_size()) {}
+
+        /// @brief Creates fixed arena, which allocates only from the provided buffer. Buffer
+        /// should outlive the arena
+        arena(void* buffer, size_t size) noexcept
+                : blocks_(nullptr)
+                , current_(static_cast<char*>(buffer))
+                , end_(static_cast<char*>(buffer) + size)
+                , buffer_(static_cast<char*>(buffer))
+                , bufferEnd_(static_cast<char*>(buffer) + size)
+                , nextBlockSize_(0) {}
+
+        arena(const arena&) = delete;
+        arena& operator=(const arena&) = delete;
+
+        /// @brief Frees heap blocks of the arena
+        ~arena() noexcept
+        {
+            free_blocks(nullptr);
+        }
+
+        /// @brief Allocates uninitialized memory
+        /// @param size size of memory in bytes
+        /// @param alignment alignment of memory, power of two
+        /// @return Pointer to allocated memory or nullptr when arena is exhausted
+        void* allocate(size_t size, size_t alignment) noexcept
+        {
+            const auto address = reinterpret_cast<uintptr_t>(current_);
+            const auto padding = static_cast<size_t>(
+                    (alignment - (address & (alignment - 1))) & (alignment - 1)
+            );
+
+            const auto available = static_cast<size_t>(end_ - current_);
+
+            // Compared without padding + size, which may overflow for the huge sizes
+            if (EXL_LIKELY(current_ != nullptr
+                    && padding <= available
+                    && size <= available - padding))
+            {
+                char* result = current_ + padding;
+                current_ = result + size;
+                return result;
+            }
+
+            return allocate_block(size, alignment);
+        }
+
+        /// @brief Creates value of type T in the arena
+        ///
+        /// When arena is exhausted, is_valid() of the box will return false
+        ///
+        /// @param args object constructor arguments
+        /// @return box which destroys the value without freeing its memory
+        template <typename T, typename ... Args>
+        arena_box<T> make(Args&& ... args)
+        noexcept(std::is_nothrow_constructible<T, Args...>::value)
+        {
+            static_assert(!std::is_array<T>::value, "exl::arena::make supports only scalar types");
+
+            void* memory = allocate(sizeof(T), alignof(T));
+            if (memory == nullptr)
+            {
+                return arena_box<T>(nullptr);
+            }
+
+            return arena_box<T>(new(memory) T(std::forward<Args>(args)...));
+        }
+
+        /// @brief Creates value of type T in the arena, exhaustion is reported as arena_exhausted
+        /// error (see exl::arena::make)
+        template <typename T, typename ... Args>
+        result<arena_box<T>, arena_exhausted> try_make(Args&& ... args)
+        noexcept(std::is_nothrow_constructible<T, Args...>::value)
+        {
+            using result_t = result<arena_box<T>, arena_exhausted>;
+
+            auto value = make<T>(std::forward<Args>(args)...);
+            if (!value.is_valid())
+            {
+                return result_t::template make_error<arena_exhausted>();
+            }
+
+            return result_t::make_ok(std::move(value));
+        }
+
+        /// @brief Reclaims memory of all values at once. Growing arena keeps its largest block
+        /// for the next allocations, other blocks are freed
+        void reset() noexcept
+        {
+            if (buffer_ != nullptr)
+            {
+                free_blocks(nullptr);
+                current_ = buffer_;
+                end_ = bufferEnd_;
+            }
+            else if (blocks_ != nullptr)
+            {
+                free_blocks(blocks_);
+                current_ = blocks_->data();
+                end_ = blocks_->end();
+            }
+        }
+
+        /// @brief Returns count of bytes left in the current block
+        size_t available() const noexcept
+        {
+            return static_cast<size_t>(end_ - current_);
+        }
+
+    private:
+        /// @brief Header of the heap block, data of the block follows the header
+        struct alignas(std::max_align_t) block
+        {
+            block* previous;
+            size_t size;
+
+            char* data() noexcept
+            {
+                return reinterpret_cast<char*>(this + 1);
+            }
+
+            char* end() noexcept
+            {
+                return data() + size;
+            }
+        };
+
+    private:
+        EXL_COLD void* allocate_block(size_t size, size_t alignment) noexcept
+        {
+            if (nextBlockSize_ == 0)
+            {
+                return nullptr;
+            }
+
+            // Data of the block is aligned to std::max_align_t, so the padding is required
+            // only for the larger alignments
+            const size_t padding = alignment > alignof(std::max_align_t) ? alignment - 1 : 0;
+            if (size > SIZE_MAX - sizeof(block) - padding)
+            {
+                return nullptr;
+            }
+
+            const size_t required = size + padding;
+
+            // Size of the next block is changed only on success, so the failed huge request
+            // doesn't affect the following allocations
+            size_t blockSize = nextBlockSize_;
+            while (blockSize < required)
+            {
+                blockSize = grown_block_size(blockSize);
+            }
+
+            if (blockSize > SIZE_MAX - sizeof(block))
+            {
+                blockSize = required;
+            }
+
+            void* memory = ::operator new(sizeof(block) + blockSize, std::nothrow);
+            if (memory == nullptr)
+            {
+                return nullptr;
+            }
+
+            block* allocated = new(memory) block { blocks_, blockSize };
+            blocks_ = allocated;
+            current_ = allocated->data();
+            end_ = allocated->end();
+            nextBlockSize_ = grown_block_size(blockSize);
+
+            return allocate(size, alignment);
+        }
+
+        /// @brief Returns doubled block size, saturated at SIZE_MAX
+        static size_t grown_block_size(size_t size) noexcept
+        {
+            return size <= SIZE_MAX / 2 ? size * 2 : SIZE_MAX;
+        }
+
+        /// @brief Frees all heap blocks except the kept one
+        void free_blocks(block* kept) noexcept
+        {
+            block* current = blocks_;
+            while (current != nullptr)
+            {
+                block* previous = current->previous;
+                if (current != kept)
+                {
+                    ::operator delete(current);
+                }
+                current = previous;
+            }
+
+            blocks_ = kept;
+            if (kept != nullptr)
+            {
+                kept->previous = nullptr;
+            }
+        }
+
+    private:
+        block* blocks_;
+        char* current_;
+        char* end_;
+        char* buffer_;
+        char* bufferEnd_;
+        size_t nextBlockSize_;
+    };
+}
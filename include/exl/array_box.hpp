@@ -0,0 +1,558 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <exl/array_view.hpp>
+#include <exl/niche_traits.hpp>
+#include <exl/relocate.hpp>
+
+#include <exl/impl/box/aligned_allocation.hpp>
+
+namespace exl
+{
+    /// @brief Exception-free dynamic array which knows its length: owns the heap array of
+    /// exactly size() elements. Replaces the (exl::box<T[]>, size) pairs: element access is
+    /// bounds-checked, the array is iterable and its part can be passed as exl::array_view.
+    ///
+    /// Bulk operations use memcpy/memset for the trivial element types. exl::array_box::resize
+    /// reallocates the array with std::realloc (which may extend the block in place) when the
+    /// element type is trivially copyable, other types are moved to the new block by
+    /// exl::relocate (single memcpy for the trivially relocatable types, see
+    /// exl::is_trivially_relocatable).
+    /// ```
+    /// auto buffer = exl::array_box<uint8_t>::make_for_overwrite(header.size);
+    /// if (!buffer || !buffer.copy_from(header.view()) || !buffer.resize(header.size + body))
+    /// {
+    ///     return Error::OutOfMemory;
+    /// }
+    /// ```
+    ///
+    /// Allocation failure is reported by is_valid() or by the false return value of
+    /// exl::array_box::resize, which keeps the array unchanged in that case.
+    ///
+    /// @tparam T element type
+    template <typename T>
+    class array_box
+    {
+    public:
+        static_assert(!std::is_array<T>::value, "exl::array_box element should not be array");
+        static_assert(
+                alignof(T) <= alignof(std::max_align_t),
+                "exl::array_box supports only types with the fundamental alignment"
+        );
+
+        using element_t = T;
+        using ptr_t = T*;
+        using const_ptr_t = const T*;
+        using ref_t = T&;
+        using const_ref_t = const T&;
+        using iterator_t = T*;
+        using const_iterator_t = const T*;
+        using view_t = array_view<T>;
+        using const_view_t = array_view<const T>;
+
+    public:
+        /// @brief Constructs invalid array box
+        array_box() noexcept
+                : data_(nullptr)
+                , size_(0) {}
+
+        /// @brief Creates array of value-initialized elements (zeroed for the trivial types)
+        ///
+        /// When allocation was failed, is_valid() will return false
+        ///
+        /// @param size array elements to create
+        /// @return array box
+        static array_box make(size_t size)
+        noexcept(std::is_nothrow_default_constructible<T>::value)
+        {
+            if (std::is_trivial<T>::value)
+            {
+                return array_box(
+                        static_cast<ptr_t>(std::calloc(size != 0 ? size : 1, sizeof(T))),
+                        size
+                );
+            }
+
+            array_box result(allocate(size), 0);
+            if (result.is_valid())
+            {
+                result.append_value_initialized(size);
+            }
+            return result;
+        }
+
+        /// @brief Creates array of default-initialized elements: elements of the trivial types
+        /// are left uninitialized, so the buffer which is overwritten right after creation is
+        /// not written twice
+        ///
+        /// When allocation was failed, is_valid() will return false
+        ///
+        /// @param size array elements to create
+        /// @return array box
+        static array_box make_for_overwrite(size_t size)
+        noexcept(std::is_nothrow_default_constructible<T>::value)
+        {
+            array_box result(allocate(size), 0);
+            if (result.is_valid())
+            {
+                result.append_default_initialized(size);
+            }
+            return result;
+        }
+
+        /// @brief Creates array of size copies of value
+        ///
+        /// When allocation was failed, is_valid() will return false
+        ///
+        /// @param size array elements to create
+        /// @param value value to copy
+        /// @return array box
+        static array_box make_filled(size_t size, const_ref_t value)
+        noexcept(std::is_nothrow_copy_constructible<T>::value)
+        {
+            array_box result(allocate(size), 0);
+            if (result.is_valid())
+            {
+                result.append_copies(size, value);
+            }
+            return result;
+        }
+
+        /// @brief Creates array of copies of the source elements
+        ///
+        /// When allocation was failed, is_valid() will return false
+        ///
+        /// @param source elements to copy
+        /// @return array box
+        static array_box make_copy(const_view_t source)
+        noexcept(std::is_nothrow_copy_constructible<T>::value)
+        {
+            array_box result(allocate(source.size()), 0);
+            if (result.is_valid())
+            {
+                result.append_copy(source);
+            }
+            return result;
+        }
+
+        /// @brief Copy construction is not permitted
+        array_box(const array_box&) = delete;
+
+        /// @brief Copy assignment is not permitted
+        array_box& operator=(const array_box&) = delete;
+
+        /// @brief Constructs array box by moving rhs, rhs becomes invalid
+        array_box(array_box&& rhs) noexcept
+                : data_(rhs.data_)
+                , size_(rhs.size_)
+        {
+            rhs.data_ = nullptr;
+            rhs.size_ = 0;
+        }
+
+        /// @brief Assigns new array, destroying previously contained one. rhs becomes invalid
+        array_box& operator=(array_box&& rhs) noexcept
+        {
+            array_box(std::move(rhs)).swap(*this);
+            return *this;
+        }
+
+        /// @brief Destroys elements and frees the array
+        ~array_box() noexcept
+        {
+            destroy(data_, data_ + size_);
+            std::free(data_);
+        }
+
+        /// @brief Swaps two array boxes
+        void swap(array_box& rhs) noexcept
+        {
+            std::swap(data_, rhs.data_);
+            std::swap(size_, rhs.size_);
+        }
+
+        /// @brief Returns false if allocation of the array has been failed
+        bool is_valid() const noexcept
+        {
+            return data_ != nullptr;
+        }
+
+        /// @brief Returns is_valid() value
+        explicit operator bool() const noexcept
+        {
+            return is_valid();
+        }
+
+        /// @brief Returns count of elements, 0 for invalid array box
+        size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        /// @brief Returns true if array has no elements
+        bool empty() const noexcept
+        {
+            return size_ == 0;
+        }
+
+        /// @brief Returns pointer to the first element or nullptr for invalid array box
+        ptr_t data() noexcept
+        {
+            return data_;
+        }
+
+        /// @brief Returns pointer to the first element or nullptr for invalid array box
+        const_ptr_t data() const noexcept
+        {
+            return data_;
+        }
+
+        /// @brief Returns element reference by index
+        /// Calls std::terminate if index is out of range or allocation has been failed
+        ref_t operator[](size_t index) noexcept
+        {
+            assert_in_range(index);
+            return data_[index];
+        }
+
+        /// @brief Returns element const reference by index
+        /// Calls std::terminate if index is out of range or allocation has been failed
+        const_ref_t operator[](size_t index) const noexcept
+        {
+            assert_in_range(index);
+            return data_[index];
+        }
+
+        /// @brief Returns view of all elements
+        view_t view() noexcept
+        {
+            return view_t(data_, size_);
+        }
+
+        /// @brief Returns view of all elements
+        const_view_t view() const noexcept
+        {
+            return const_view_t(data_, size_);
+        }
+
+        iterator_t begin() noexcept
+        {
+            return data_;
+        }
+
+        iterator_t end() noexcept
+        {
+            return data_ + size_;
+        }
+
+        const_iterator_t begin() const noexcept
+        {
+            return data_;
+        }
+
+        const_iterator_t end() const noexcept
+        {
+            return data_ + size_;
+        }
+
+        /// @brief Copies source elements to the array starting at offset, with the single
+        /// memcpy for the trivially copyable types
+        ///
+        /// @warning Source should not overlap with the destination range
+        ///
+        /// @param source elements to copy
+        /// @param offset index of the first element to overwrite
+        /// @return false if source doesn't fit in the array, nothing is copied in that case
+        bool copy_from(const_view_t source, size_t offset = 0)
+        noexcept(std::is_nothrow_copy_assignable<T>::value)
+        {
+            if (offset > size_ || source.size() > size_ - offset)
+            {
+                return false;
+            }
+
+            copy_from(source, offset, std::is_trivially_copyable<T>());
+            return true;
+        }
+
+        /// @brief Assigns value to all elements, with the single memset when value of the
+        /// trivially copyable type consists of the same bytes (e.g. zero)
+        void fill(const_ref_t value) noexcept(std::is_nothrow_copy_assignable<T>::value)
+        {
+            fill(value, std::is_trivially_copyable<T>());
+        }
+
+        /// @brief Changes count of elements. Elements which fit in the new size are kept, new
+        /// elements are value-initialized. Invalid array box is resized as the empty one.
+        /// Elements of the types which are not trivially relocatable should be nothrow
+        /// move-constructible
+        ///
+        /// @return false if allocation has failed, array is unchanged in that case
+        bool resize(size_t size) noexcept(std::is_nothrow_default_constructible<T>::value)
+        {
+            if (size == size_ && is_valid())
+            {
+                return true;
+            }
+
+            if (size < size_)
+            {
+                destroy(data_ + size, data_ + size_);
+                size_ = size;
+
+                // Smaller block is not required, so the failure is ignored
+                ptr_t shrunk = reallocate(size);
+                if (shrunk != nullptr)
+                {
+                    data_ = shrunk;
+                }
+                return true;
+            }
+
+            ptr_t grown = reallocate(size);
+            if (grown == nullptr)
+            {
+                return false;
+            }
+
+            data_ = grown;
+            append_value_initialized(size - size_);
+            return true;
+        }
+
+    private:
+        array_box(ptr_t data, size_t size) noexcept
+                : data_(data)
+                , size_(data != nullptr ? size : 0) {}
+
+        static ptr_t allocate(size_t count) noexcept
+        {
+            const size_t bytes = impl::array_bytes<T>(count);
+            if (bytes == 0 && count != 0)
+            {
+                return nullptr;
+            }
+
+            return static_cast<ptr_t>(std::malloc(bytes != 0 ? bytes : 1));
+        }
+
+        /// @brief Moves first min(count, size_) elements to the block of count elements
+        /// @return New block or nullptr when allocation has failed, array is unchanged then
+        ptr_t reallocate(size_t count) noexcept
+        {
+            return reallocate(
+                    count,
+                    std::integral_constant<bool, std::is_trivially_copyable<T>::value>()
+            );
+        }
+
+        ptr_t reallocate(size_t count, std::true_type) noexcept
+        {
+            const size_t bytes = impl::array_bytes<T>(count);
+            if (bytes == 0 && count != 0)
+            {
+                return nullptr;
+            }
+
+            return static_cast<ptr_t>(std::realloc(data_, bytes != 0 ? bytes : 1));
+        }
+
+        ptr_t reallocate(size_t count, std::false_type) noexcept
+        {
+            ptr_t block = allocate(count);
+            if (block != nullptr)
+            {
+                relocate(data_, data_ + std::min(count, size_), block);
+                std::free(data_);
+            }
+            return block;
+        }
+
+        static void destroy(ptr_t first, ptr_t last) noexcept
+        {
+            if (!std::is_trivially_destructible<T>::value)
+            {
+                for (; first != last; ++first)
+                {
+                    first->~T();
+                }
+            }
+        }
+
+        // Append functions construct elements in the allocated memory past the last element.
+        // size_ is incremented after each construction, so the constructed elements are
+        // destroyed by the array box when the constructor of the next one throws
+
+        void append_value_initialized(size_t count)
+        {
+            if (std::is_trivial<T>::value)
+            {
+                std::memset(static_cast<void*>(data_ + size_), 0, count * sizeof(T));
+                size_ += count;
+                return;
+            }
+
+            for (; count != 0; --count, ++size_)
+            {
+                new(data_ + size_) T();
+            }
+        }
+
+        void append_default_initialized(size_t count)
+        {
+            if (std::is_trivial<T>::value)
+            {
+                size_ += count;
+                return;
+            }
+
+            for (; count != 0; --count, ++size_)
+            {
+                new(data_ + size_) T;
+            }
+        }
+
+        void append_copies(size_t count, const_ref_t value)
+        {
+            for (; count != 0; --count, ++size_)
+            {
+                new(data_ + size_) T(value);
+            }
+        }
+
+        void append_copy(const_view_t source)
+        {
+            if (std::is_trivially_copyable<T>::value)
+            {
+                // Empty view may have null data, which is not allowed for memcpy
+                if (source.empty())
+                {
+                    return;
+                }
+
+                std::memcpy(
+                        static_cast<void*>(data_ + size_),
+                        static_cast<const void*>(source.data()),
+                        source.size_bytes()
+                );
+                size_ += source.size();
+                return;
+            }
+
+            for (const_ref_t value : source)
+            {
+                new(data_ + size_) T(value);
+                ++size_;
+            }
+        }
+
+        void copy_from(const_view_t source, size_t offset, std::true_type) noexcept
+        {
+            // Both empty view and invalid array box have null data
+            if (source.empty())
+            {
+                return;
+            }
+
+            std::memcpy(
+                    static_cast<void*>(data_ + offset),
+                    static_cast<const void*>(source.data()),
+                    source.size_bytes()
+            );
+        }
+
+        void copy_from(const_view_t source, size_t offset, std::false_type)
+        {
+            std::copy(source.begin(), source.end(), data_ + offset);
+        }
+
+        void fill(const_ref_t value, std::true_type) noexcept
+        {
+            // Invalid array box has null data, which is not allowed for memset
+            if (size_ == 0)
+            {
+                return;
+            }
+
+            const auto bytes = reinterpret_cast<const unsigned char*>(&value);
+            for (size_t i = 1; i < sizeof(T); ++i)
+            {
+                if (bytes[i] != bytes[0])
+                {
+                    std::fill(data_, data_ + size_, value);
+                    return;
+                }
+            }
+
+            std::memset(static_cast<void*>(data_), bytes[0], size_ * sizeof(T));
+        }
+
+        void fill(const_ref_t value, std::false_type)
+        {
+            std::fill(data_, data_ + size_, value);
+        }
+
+        void assert_in_range(size_t index) const noexcept
+        {
+            if (index >= size_)
+            {
+                std::terminate();
+            }
+        }
+
+    private:
+        ptr_t data_;
+        size_t size_;
+    };
+
+    /// @brief Niche of exl::array_box is invalid array box, so exl::option<exl::array_box<T>>
+    /// has the same size as exl::array_box<T>
+    template <typename T>
+    struct niche_traits<array_box<T>>
+    {
+        static constexpr bool has_niche()
+        {
+            return true;
+        }
+
+        static bool is_niche(const array_box<T>& value) noexcept
+        {
+            return !value.is_valid();
+        }
+
+        static void construct_niche(void* storage) noexcept
+        {
+            new(storage) array_box<T>();
+        }
+    };
+
+    /// @brief exl::array_box holds only the pointer and the size, so it is trivially relocatable
+    template <typename T>
+    struct is_trivially_relocatable<array_box<T>>
+    {
+        static constexpr bool value() { return true; }
+    };
+}
+
+namespace std
+{
+    /// @brief std::swap specialization for exl::array_box<T>
+    template <typename T>
+    void swap(exl::array_box<T>& lhs, exl::array_box<T>& rhs) noexcept
+    {
+        lhs.swap(rhs);
+    }
+}
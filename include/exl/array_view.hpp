@@ -0,0 +1,130 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <cstddef>
+#include <exception>
+#include <type_traits>
+
+namespace exl
+{
+    /// @brief Non-owning view of the contiguous array: pointer to the first element and count of
+    /// elements. Cheap to copy, should be passed by value.
+    ///
+    /// View of the const elements is created implicitly from the view of the mutable ones.
+    /// ```
+    /// void send(exl::array_view<const uint8_t> payload);
+    ///
+    /// auto buffer = exl::array_box<uint8_t>::make(1024);
+    /// send(buffer.view().subview(0, received));
+    /// ```
+    ///
+    /// @tparam T element type, may be const-qualified
+    template <typename T>
+    class array_view
+    {
+    public:
+        using element_t = T;
+        using ptr_t = T*;
+        using ref_t = T&;
+        using iterator_t = T*;
+
+    public:
+        /// @brief Constructs empty view
+        constexpr array_view() noexcept
+                : data_(nullptr)
+                , size_(0) {}
+
+        /// @brief Constructs view of size elements starting at data
+        constexpr array_view(ptr_t data, size_t size) noexcept
+                : data_(data)
+                , size_(size) {}
+
+        /// @brief Constructs view of the whole C array
+        template <size_t N>
+        constexpr array_view(T (&array)[N]) noexcept
+                : data_(array)
+                , size_(N) {}
+
+        /// @brief Constructs view of the compatible elements (e.g. view of the const elements
+        /// from the view of the mutable ones)
+        template <
+                typename U,
+                typename = typename std::enable_if<
+                        std::is_convertible<U(*)[], T(*)[]>::value
+                >::type
+        >
+        constexpr array_view(const array_view<U>& rhs) noexcept
+                : data_(rhs.data())
+                , size_(rhs.size()) {}
+
+        /// @brief Returns pointer to the first element
+        constexpr ptr_t data() const noexcept
+        {
+            return data_;
+        }
+
+        /// @brief Returns count of elements
+        constexpr size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        /// @brief Returns size of elements in bytes
+        constexpr size_t size_bytes() const noexcept
+        {
+            return size_ * sizeof(T);
+        }
+
+        /// @brief Returns true if view has no elements
+        constexpr bool empty() const noexcept
+        {
+            return size_ == 0;
+        }
+
+        /// @brief Returns element reference by index
+        /// Calls std::terminate if index is out of range
+        ref_t operator[](size_t index) const noexcept
+        {
+            if (index >= size_)
+            {
+                std::terminate();
+            }
+
+            return data_[index];
+        }
+
+        /// @brief Returns view of count elements starting at offset. Range is clamped to the
+        /// view bounds
+        array_view subview(size_t offset, size_t count) const noexcept
+        {
+            if (offset > size_)
+            {
+                offset = size_;
+            }
+            if (count > size_ - offset)
+            {
+                count = size_ - offset;
+            }
+
+            return array_view(data_ + offset, count);
+        }
+
+        constexpr iterator_t begin() const noexcept
+        {
+            return data_;
+        }
+
+        constexpr iterator_t end() const noexcept
+        {
+            return data_ + size_;
+        }
+
+    private:
+        ptr_t data_;
+        size_t size_;
+    };
+}
@@ -10,17 +10,36 @@
 #include <utility>
 #include <functional>
 #include <cstdint>
+#include <cstddef>
+#include <exception>
 
 #include <exl/in_place.hpp>
+#include <exl/niche_traits.hpp>
+#include <exl/relocate.hpp>
 
+#include <exl/details/box/aligned_deleter.hpp>
+#include <exl/details/box/allocator_deleter.hpp>
 #include <exl/details/box/deleter_function.hpp>
 #include <exl/details/box/deleter_object.hpp>
 #include <exl/details/box/get_default_deleter.hpp>
 
+#include <exl/impl/box/aligned_allocation.hpp>
+#include <exl/impl/box/allocator_allocation.hpp>
 #include <exl/impl/box/boxed_ptr.hpp>
 
 #include <exl/matchers.hpp>
 
+#if defined(__has_include)
+    #if __has_include(<memory_resource>) && __cplusplus >= 201703L
+        #include <memory_resource>
+        #define EXL_HAS_MEMORY_RESOURCE 1
+    #endif
+#endif
+
+#ifndef EXL_HAS_MEMORY_RESOURCE
+    #define EXL_HAS_MEMORY_RESOURCE 0
+#endif
+
 namespace exl
 {
     /// @brief Represents type which provides exception-less dynamic allocation mechanism
@@ -37,6 +56,9 @@ namespace exl
     class box
     {
     public:
+        template <typename U, typename UDeleter>
+        friend class box;
+
         using boxed_ptr_t = impl::boxed_ptr<T, Deleter>;
 
         using element_t = typename std::remove_all_extents<T>::type;
@@ -63,6 +85,9 @@ namespace exl
 
         /// @brief Creates boxed type
         ///
+        /// Requires the default deleter, boxes with the custom deleter (exl::allocator_box,
+        /// exl::arena_box, ...) are created by their own factories
+        ///
         /// When allocation was failed, is_valid() will return false
         ///
         /// @tparam Args object constructor arguments types
@@ -76,11 +101,19 @@ namespace exl
         static box make(Args&& ... args)
         noexcept(std::is_nothrow_constructible<element_t, Args...>::value)
         {
+            static_assert(
+                    std::is_same<Deleter, typename get_default_deleter<T>::type>::value,
+                    "exl::box::make allocates with new, it requires the default deleter"
+            );
+
             return box(new(std::nothrow) element_t(std::forward<Args>(args)...));
         }
 
         /// @brief Creates boxed array
         ///
+        /// Requires the default deleter, boxes with the custom deleter (exl::allocator_box,
+        /// exl::arena_box, ...) are created by their own factories
+        ///
         /// When allocation was failed, is_valid() will return false
         ///
         /// @param N array elements to create
@@ -93,11 +126,19 @@ namespace exl
         static box make_array()
         noexcept(std::is_nothrow_constructible<element_t>::value)
         {
+            static_assert(
+                    std::is_same<Deleter, typename get_default_deleter<T>::type>::value,
+                    "exl::box::make_array allocates with new, it requires the default deleter"
+            );
+
             return box(new(std::nothrow) element_t[N]);
         }
 
         /// @brief Creates boxed array
         ///
+        /// Requires the default deleter, boxes with the custom deleter (exl::allocator_box,
+        /// exl::arena_box, ...) are created by their own factories
+        ///
         /// When allocation was failed, is_valid() will return false
         ///
         /// @param size array elements to create
@@ -109,9 +150,169 @@ namespace exl
         static box make_array(size_t array_size)
         noexcept(std::is_nothrow_constructible<element_t>::value)
         {
+            static_assert(
+                    std::is_same<Deleter, typename get_default_deleter<T>::type>::value,
+                    "exl::box::make_array allocates with new, it requires the default deleter"
+            );
+
             return box(new(std::nothrow) element_t[array_size]);
         }
 
+        /// @brief Creates boxed array of default-initialized elements: elements of trivial types
+        /// are left uninitialized, so the buffer which is overwritten right after creation is
+        /// not written twice. Same as exl::box::make_array, named after
+        /// std::make_unique_for_overwrite to state the intent
+        ///
+        /// Requires the default deleter, boxes with the custom deleter (exl::allocator_box,
+        /// exl::arena_box, ...) are created by their own factories
+        ///
+        /// When allocation was failed, is_valid() will return false
+        ///
+        /// @param array_size array elements to create
+        /// @return boxed array
+        template <
+                typename U = T,
+                typename = typename std::enable_if<std::is_array<U>::value>::type
+        >
+        static box make_array_for_overwrite(size_t array_size)
+        noexcept(std::is_nothrow_default_constructible<element_t>::value)
+        {
+            static_assert(
+                    std::is_same<Deleter, typename get_default_deleter<T>::type>::value,
+                    "exl::box::make_array_for_overwrite allocates with new, "
+                    "it requires the default deleter"
+            );
+
+            return box(new(std::nothrow) element_t[array_size]);
+        }
+
+        /// @brief Creates boxed array of uninitialized trivial elements with specified alignment
+        /// (e.g. 64 for SIMD loads, 4096 for direct I/O). Deleter of the box should be produced
+        /// by exl::get_aligned_deleter (see exl::aligned_box), it is empty
+        ///
+        /// When allocation was failed, array is empty or alignment is not the power of two,
+        /// is_valid() will return false
+        ///
+        /// @param array_size array elements to create
+        /// @param alignment alignment of the first element in bytes, power of two
+        /// @return boxed array
+        template <
+                typename U = T,
+                typename = typename std::enable_if<std::is_array<U>::value>::type
+        >
+        static box make_array_aligned(size_t array_size, size_t alignment) noexcept
+        {
+            static_assert(
+                    std::is_same<Deleter, typename get_aligned_deleter<T>::type>::value,
+                    "exl::box::make_array_aligned requires exl::aligned_box<T[]>"
+            );
+            static_assert(
+                    std::is_trivial<element_t>::value,
+                    "exl::box::make_array_aligned requires trivial element type"
+            );
+
+            const size_t bytes = impl::array_bytes<element_t>(array_size);
+            const size_t elementAlignment = alignof(element_t);
+
+            return box(static_cast<ptr_t>(impl::aligned_allocate(
+                    bytes,
+                    alignment > elementAlignment ? alignment : elementAlignment
+            )));
+        }
+
+        /// @brief Creates boxed array of uninitialized trivial elements, aligned to 2 MB and
+        /// backed by transparent huge pages where the platform supports them (Linux), which
+        /// reduces TLB misses on the random access to the large tables. Other platforms get
+        /// 2 MB-aligned heap memory. Deleter of the box should be produced by
+        /// exl::get_huge_page_deleter (see exl::huge_page_box), it keeps size of the mapping
+        ///
+        /// When allocation was failed or array is empty, is_valid() will return false
+        ///
+        /// @param array_size array elements to create
+        /// @return boxed array
+        template <
+                typename U = T,
+                typename = typename std::enable_if<std::is_array<U>::value>::type
+        >
+        static box make_array_huge_pages(size_t array_size) noexcept
+        {
+            static_assert(
+                    std::is_same<Deleter, typename get_huge_page_deleter<T>::type>::value,
+                    "exl::box::make_array_huge_pages requires exl::huge_page_box<T[]>"
+            );
+            static_assert(
+                    std::is_trivial<element_t>::value,
+                    "exl::box::make_array_huge_pages requires trivial element type"
+            );
+
+            size_t mapped = 0;
+            void* memory = impl::huge_page_allocate(
+                    impl::array_bytes<element_t>(array_size),
+                    mapped
+            );
+            return box(static_cast<ptr_t>(memory), Deleter(huge_page_deleter<element_t>(mapped)));
+        }
+
+        /// @brief Creates boxed object in the memory obtained from the allocator. Deleter of the
+        /// box should be produced by exl::get_allocator_deleter (see exl::allocator_box), it
+        /// returns the memory to the same allocator on destruction
+        ///
+        /// When allocation was failed, is_valid() will return false
+        ///
+        /// @param allocator allocator to allocate from, rebound to the boxed type
+        /// @param args object constructor arguments
+        /// @return boxed object
+        template <
+                typename Allocator,
+                typename U = T,
+                typename = typename std::enable_if<!std::is_array<U>::value>::type,
+                typename ... Args
+        >
+        static box allocate_make(const Allocator& allocator, Args&& ... args)
+        noexcept(std::is_nothrow_constructible<element_t, Args...>::value)
+        {
+            using get_deleter_t = get_allocator_deleter<T, Allocator>;
+            static_assert(
+                    std::is_same<Deleter, typename get_deleter_t::type>::value,
+                    "exl::box::allocate_make requires exl::allocator_box<T, Allocator>"
+            );
+
+            typename get_deleter_t::allocator_t elementAllocator(allocator);
+            ptr_t ptr = impl::allocator_allocation<typename get_deleter_t::allocator_t>::make(
+                    elementAllocator,
+                    std::forward<Args>(args)...
+            );
+            return box(ptr, get_deleter_t::make(elementAllocator, 1));
+        }
+
+        /// @brief Creates boxed array of value-initialized elements in the memory obtained from
+        /// the allocator (see exl::box::allocate_make)
+        ///
+        /// When allocation was failed, is_valid() will return false
+        ///
+        /// @param allocator allocator to allocate from, rebound to the element type
+        /// @param array_size array elements to create
+        /// @return boxed array
+        template <
+                typename Allocator,
+                typename U = T,
+                typename = typename std::enable_if<std::is_array<U>::value>::type
+        >
+        static box allocate_make_array(const Allocator& allocator, size_t array_size)
+        noexcept(std::is_nothrow_default_constructible<element_t>::value)
+        {
+            using get_deleter_t = get_allocator_deleter<T, Allocator>;
+            static_assert(
+                    std::is_same<Deleter, typename get_deleter_t::type>::value,
+                    "exl::box::allocate_make_array requires exl::allocator_box<T, Allocator>"
+            );
+
+            typename get_deleter_t::allocator_t elementAllocator(allocator);
+            ptr_t ptr = impl::allocator_allocation<typename get_deleter_t::allocator_t>
+                    ::make_array(elementAllocator, array_size);
+            return box(ptr, get_deleter_t::make(elementAllocator, array_size));
+        }
+
         /// @brief Constructs box from pointer with default-constructed deleter
         ///
         /// is_valid will return false if provided pointer is nullptr
@@ -421,6 +622,71 @@ namespace exl
     private:
         boxed_ptr_t ptr_;
     };
+
+    /// @brief exl::box which allocates its value with the allocator, created by
+    /// exl::box::allocate_make and exl::box::allocate_make_array.
+    ///
+    /// Box of the value allocated with the stateless allocator (e.g. std::allocator) is as small
+    /// as the pointer. Stateful allocators (e.g. std::pmr::polymorphic_allocator) are kept in the
+    /// deleter, so boxes allocated from the different memory resources have the same type.
+    /// ```
+    /// std::pmr::monotonic_buffer_resource requestArena;
+    /// auto node = exl::pmr::box<Node>::allocate_make(
+    ///     std::pmr::polymorphic_allocator<Node>(&requestArena), key, value);
+    /// ```
+    template <typename T, typename Allocator>
+    using allocator_box = box<T, typename get_allocator_deleter<T, Allocator>::type>;
+
+    /// @brief exl::box of the over-aligned array created by exl::box::make_array_aligned, has
+    /// size of the pointer
+    template <typename T>
+    using aligned_box = box<T, typename get_aligned_deleter<T>::type>;
+
+    /// @brief exl::box of the huge page backed array created by
+    /// exl::box::make_array_huge_pages
+    template <typename T>
+    using huge_page_box = box<T, typename get_huge_page_deleter<T>::type>;
+
+#if EXL_HAS_MEMORY_RESOURCE
+    namespace pmr
+    {
+        /// @brief exl::box which allocates its value from the std::pmr::memory_resource
+        template <typename T>
+        using box = allocator_box<
+                T,
+                std::pmr::polymorphic_allocator<typename std::remove_all_extents<T>::type>
+        >;
+    }
+#endif
+
+    /// @brief Niche of exl::box is invalid box (which holds nullptr), so exl::option<exl::box<T>>
+    /// has the same size as exl::box<T>
+    template <typename T, typename Deleter>
+    struct niche_traits<box<T, Deleter>>
+    {
+        static constexpr bool has_niche()
+        {
+            return std::is_nothrow_default_constructible<Deleter>::value;
+        }
+
+        static bool is_niche(const box<T, Deleter>& value) noexcept
+        {
+            return !value.is_valid();
+        }
+
+        static void construct_niche(void* storage) noexcept
+        {
+            new(storage) box<T, Deleter>(nullptr);
+        }
+    };
+
+    /// @brief exl::box holds only the pointer and the deleter, so it is trivially relocatable
+    /// when its deleter is
+    template <typename T, typename Deleter>
+    struct is_trivially_relocatable<box<T, Deleter>>
+    {
+        static constexpr bool value() { return is_trivially_relocatable<Deleter>::value(); }
+    };
 }
 
 namespace std
@@ -0,0 +1,70 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <cstddef>
+
+#include <exl/details/box/deleter_function.hpp>
+#include <exl/details/box/deleter_object.hpp>
+
+#include <exl/impl/box/aligned_allocation.hpp>
+
+namespace exl
+{
+    namespace impl
+    {
+        template <typename T>
+        void aligned_delete_array(T* p) noexcept { aligned_free(p); }
+    }
+
+    /// @brief Returns exl::box deleter for the arrays created by exl::box::make_array_aligned:
+    /// memory is freed without destruction of the trivial elements, so the deleter is empty
+    template <typename T>
+    struct get_aligned_deleter;
+
+    template <typename U>
+    struct get_aligned_deleter<U[]>
+    {
+        using type = deleter_function<U[], impl::aligned_delete_array<U>>;
+    };
+
+    /// @brief Deleter for exl::deleter_object, which unmaps the array created by
+    /// exl::box::make_array_huge_pages. Keeps size of the mapping
+    template <typename T>
+    class huge_page_deleter
+    {
+    public:
+        huge_page_deleter() noexcept
+                : mapped_(0) {}
+
+        explicit huge_page_deleter(size_t mapped) noexcept
+                : mapped_(mapped) {}
+
+        void operator()(T* obj) noexcept
+        {
+            impl::huge_page_free(obj, mapped_);
+        }
+
+        /// @brief Returns size of the mapping in bytes, multiple of the huge page size
+        size_t mapped_size() const noexcept
+        {
+            return mapped_;
+        }
+
+    private:
+        size_t mapped_;
+    };
+
+    /// @brief Returns exl::box deleter for the arrays created by exl::box::make_array_huge_pages
+    template <typename T>
+    struct get_huge_page_deleter;
+
+    template <typename U>
+    struct get_huge_page_deleter<U[]>
+    {
+        using type = deleter_object<U[], huge_page_deleter<U>>;
+    };
+}
@@ -0,0 +1,226 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <exl/relocate.hpp>
+
+#include <exl/details/box/deleter_object.hpp>
+
+#include <exl/impl/box/allocator_allocation.hpp>
+
+namespace exl
+{
+    /// @brief Deleter for exl::deleter_object, which returns value created by
+    /// exl::box::allocate_make to the allocator it was allocated from.
+    ///
+    /// Keeps copy of the allocator (e.g. std::pmr::polymorphic_allocator which points to the
+    /// memory resource), so boxes created with different allocators have the same type.
+    ///
+    /// @tparam T boxed type
+    /// @tparam Allocator allocator type, rebound to the element type of T
+    ///
+    /// @warning Default-constructed deleter uses default-constructed allocator
+    template <typename T, typename Allocator>
+    class allocator_deleter
+    {
+    public:
+        using element_t = typename std::remove_all_extents<T>::type;
+        using allocator_t = typename std::allocator_traits<Allocator>
+                ::template rebind_alloc<element_t>;
+
+    public:
+        allocator_deleter() noexcept
+                : allocator_() {}
+
+        explicit allocator_deleter(const allocator_t& allocator) noexcept
+                : allocator_(allocator) {}
+
+        allocator_deleter(allocator_deleter&& rhs) noexcept
+                : allocator_(std::move(rhs.allocator_)) {}
+
+        // Allocators are not required to be assignable (e.g. std::pmr::polymorphic_allocator),
+        // so allocator is reconstructed from rhs instead
+        allocator_deleter& operator=(allocator_deleter&& rhs) noexcept
+        {
+            allocator_.~allocator_t();
+            new(&allocator_) allocator_t(std::move(rhs.allocator_));
+            return *this;
+        }
+
+        void operator()(element_t* obj) noexcept
+        {
+            impl::allocator_allocation<allocator_t>::destroy(allocator_, obj, 1, 1);
+        }
+
+        /// @brief Returns allocator which allocated the value
+        const allocator_t& get_allocator() const noexcept
+        {
+            return allocator_;
+        }
+
+    private:
+        allocator_t allocator_;
+    };
+
+    /// @brief Deleter of the array created by exl::box::allocate_make_array. Keeps array size,
+    /// which is required to destroy the elements and to deallocate the array
+    template <typename T, typename Allocator>
+    class allocator_deleter<T[], Allocator>
+    {
+    public:
+        using element_t = typename std::remove_all_extents<T>::type;
+        using allocator_t = typename std::allocator_traits<Allocator>
+                ::template rebind_alloc<element_t>;
+
+    public:
+        allocator_deleter() noexcept
+                : allocator_()
+                , size_(0) {}
+
+        allocator_deleter(const allocator_t& allocator, size_t size) noexcept
+                : allocator_(allocator)
+                , size_(size) {}
+
+        allocator_deleter(allocator_deleter&& rhs) noexcept
+                : allocator_(std::move(rhs.allocator_))
+                , size_(rhs.size_) {}
+
+        allocator_deleter& operator=(allocator_deleter&& rhs) noexcept
+        {
+            allocator_.~allocator_t();
+            new(&allocator_) allocator_t(std::move(rhs.allocator_));
+            size_ = rhs.size_;
+            return *this;
+        }
+
+        void operator()(element_t* obj) noexcept
+        {
+            impl::allocator_allocation<allocator_t>::destroy(allocator_, obj, size_, size_);
+        }
+
+        /// @brief Returns allocator which allocated the array
+        const allocator_t& get_allocator() const noexcept
+        {
+            return allocator_;
+        }
+
+        /// @brief Returns count of the array elements
+        size_t size() const noexcept
+        {
+            return size_;
+        }
+
+    private:
+        allocator_t allocator_;
+        size_t size_;
+    };
+
+    /// @brief Deleter of the value created by exl::box::allocate_make with the stateless
+    /// allocator (e.g. std::allocator). Allocator is default-constructed on deletion, so the
+    /// deleter is empty and exl::box has the size of the pointer
+    template <typename T, typename Allocator>
+    class stateless_allocator_deleter
+    {
+    public:
+        using allocator_t = typename std::allocator_traits<Allocator>::template rebind_alloc<T>;
+        using ptr_t = T*;
+
+        static_assert(
+                std::is_empty<allocator_t>::value
+                        && std::is_nothrow_default_constructible<allocator_t>::value,
+                "Allocator of exl::stateless_allocator_deleter should be empty and nothrow "
+                "default-constructible"
+        );
+
+    public:
+        static void destroy(ptr_t obj) noexcept
+        {
+            allocator_t allocator;
+            impl::allocator_allocation<allocator_t>::destroy(allocator, obj, 1, 1);
+        }
+    };
+
+    /// @brief Returns exl::box deleter for values allocated with the allocator: empty
+    /// exl::stateless_allocator_deleter for scalars allocated with the stateless allocator,
+    /// exl::deleter_object with exl::allocator_deleter otherwise
+    template <typename T, typename Allocator>
+    struct get_allocator_deleter
+    {
+    private:
+        using object_deleter_t = allocator_deleter<T, Allocator>;
+
+        static constexpr bool is_stateless()
+        {
+            return !std::is_array<T>::value
+                    && std::is_empty<typename object_deleter_t::allocator_t>::value
+                    && std::is_nothrow_default_constructible<
+                            typename object_deleter_t::allocator_t
+                    >::value;
+        }
+
+    public:
+        using allocator_t = typename object_deleter_t::allocator_t;
+        using type = typename std::conditional<
+                is_stateless(),
+                stateless_allocator_deleter<T, Allocator>,
+                deleter_object<T, object_deleter_t>
+        >::type;
+
+        /// @brief Creates deleter for the value or array of specified size allocated with the
+        /// allocator
+        static type make(const allocator_t& allocator, size_t size) noexcept
+        {
+            return make(allocator, size, std::integral_constant<bool, is_stateless()>());
+        }
+
+    private:
+        static type make(const allocator_t&, size_t, std::true_type) noexcept
+        {
+            return type();
+        }
+
+        template <typename U = T>
+        static type make(
+                const allocator_t& allocator,
+                size_t,
+                std::false_type,
+                typename std::enable_if<!std::is_array<U>::value>::type* = nullptr
+        ) noexcept
+        {
+            return type(object_deleter_t(allocator));
+        }
+
+        template <typename U = T>
+        static type make(
+                const allocator_t& allocator,
+                size_t size,
+                std::false_type,
+                typename std::enable_if<std::is_array<U>::value>::type* = nullptr
+        ) noexcept
+        {
+            return type(object_deleter_t(allocator, size));
+        }
+    };
+
+    /// @brief Allocator deleter holds only the allocator (and the array size), so it is trivially
+    /// relocatable when the allocator is
+    template <typename T, typename Allocator>
+    struct is_trivially_relocatable<allocator_deleter<T, Allocator>>
+    {
+        static constexpr bool value()
+        {
+            return is_trivially_relocatable<
+                    typename allocator_deleter<T, Allocator>::allocator_t
+            >::value();
+        }
+    };
+}
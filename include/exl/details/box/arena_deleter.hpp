@@ -0,0 +1,50 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <type_traits>
+
+namespace exl
+{
+    /// @brief Deleter of the value created by exl::arena::make. Only destroys the value: memory
+    /// is owned by the arena and is reclaimed all at once by exl::arena::reset, so the deleter
+    /// is empty and exl::box has the size of the pointer
+    ///
+    /// @tparam T type to destroy
+    template <typename T>
+    class arena_deleter
+    {
+    public:
+        static_assert(!std::is_array<T>::value, "exl::arena_deleter supports only scalar types");
+
+        using ptr_t = T*;
+
+    public:
+        arena_deleter() noexcept = default;
+
+        /// @brief Allows conversion of box with the derived type to the box with the base type,
+        /// value is destroyed with its virtual destructor
+        template <
+                typename U,
+                typename = typename std::enable_if<std::is_convertible<U*, ptr_t>::value>::type
+        >
+        arena_deleter(arena_deleter<U>&&) noexcept {}
+
+        template <
+                typename U,
+                typename = typename std::enable_if<std::is_convertible<U*, ptr_t>::value>::type
+        >
+        arena_deleter& operator=(arena_deleter<U>&&) noexcept
+        {
+            return *this;
+        }
+
+        static void destroy(ptr_t obj) noexcept
+        {
+            obj->~T();
+        }
+    };
+}
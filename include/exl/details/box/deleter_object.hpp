@@ -8,6 +8,8 @@
 #include <type_traits>
 #include <utility>
 
+#include <exl/relocate.hpp>
+
 namespace exl
 {
     /// @brief Provides type to define exl::box deleter with custom object type
@@ -125,4 +127,11 @@ namespace exl
     private:
         Deleter deleter_;
     };
+
+    /// @brief exl::deleter_object is trivially relocatable when its deleter is
+    template <typename T, typename Deleter>
+    struct is_trivially_relocatable<deleter_object<T, Deleter>>
+    {
+        static constexpr bool value() { return is_trivially_relocatable<Deleter>::value(); }
+    };
 }
\ No newline at end of file
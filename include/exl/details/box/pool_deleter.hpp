@@ -0,0 +1,35 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <type_traits>
+
+namespace exl
+{
+    template <typename T>
+    class pool;
+
+    /// @brief Deleter of the value created by exl::pool::make. Destroys the value and returns
+    /// its slot to the pool which allocated it. Slot knows its pool, so the deleter is empty and
+    /// exl::box has the size of the pointer
+    ///
+    /// @tparam T type to destroy
+    template <typename T>
+    class pool_deleter
+    {
+    public:
+        static_assert(!std::is_array<T>::value, "exl::pool_deleter supports only scalar types");
+
+        using ptr_t = T*;
+
+    public:
+        static void destroy(ptr_t obj) noexcept
+        {
+            obj->~T();
+            pool<T>::recycle(obj);
+        }
+    };
+}
@@ -0,0 +1,132 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+
+#if defined(_WIN32)
+    #include <malloc.h>
+#endif
+
+#if defined(__linux__)
+    #include <sys/mman.h>
+#endif
+
+namespace exl { namespace impl
+{
+    /// @brief Size of the transparent huge page
+    constexpr size_t huge_page_size = size_t(2) * 1024 * 1024;
+
+    /// @brief Returns size of count elements of type T or 0 when it overflows size_t
+    template <typename T>
+    constexpr size_t array_bytes(size_t count)
+    {
+        return count <= SIZE_MAX / sizeof(T) ? count * sizeof(T) : 0;
+    }
+
+    /// @brief Allocates memory with specified alignment
+    /// @param bytes size of memory, should not be 0
+    /// @param alignment power of two
+    /// @return Pointer to the memory or nullptr when allocation has failed or alignment is
+    /// invalid
+    inline void* aligned_allocate(size_t bytes, size_t alignment) noexcept
+    {
+        if (bytes == 0 || alignment == 0 || (alignment & (alignment - 1)) != 0)
+        {
+            return nullptr;
+        }
+
+        if (alignment < sizeof(void*))
+        {
+            alignment = sizeof(void*);
+        }
+
+#if defined(_WIN32)
+        return _aligned_malloc(bytes, alignment);
+#else
+        void* memory = nullptr;
+        return posix_memalign(&memory, alignment, bytes) == 0 ? memory : nullptr;
+#endif
+    }
+
+    /// @brief Frees memory allocated by aligned_allocate
+    inline void aligned_free(void* memory) noexcept
+    {
+#if defined(_WIN32)
+        _aligned_free(memory);
+#else
+        std::free(memory);
+#endif
+    }
+
+    /// @brief Maps memory aligned to the huge page and asks the kernel to back it with the
+    /// transparent huge pages. Falls back to huge page aligned heap memory when memory mapping
+    /// is not supported
+    /// @param bytes size of memory, should not be 0
+    /// @param mapped [out] size of the mapping, required by huge_page_free
+    /// @return Pointer to the memory or nullptr when allocation has failed
+    inline void* huge_page_allocate(size_t bytes, size_t& mapped) noexcept
+    {
+        if (bytes == 0 || bytes > SIZE_MAX - 2 * huge_page_size)
+        {
+            return nullptr;
+        }
+
+        mapped = (bytes + huge_page_size - 1) & ~(huge_page_size - 1);
+
+#if defined(__linux__)
+        // Mapping is over-allocated by the huge page and trimmed to the aligned range
+        const size_t reserved = mapped + huge_page_size;
+        void* raw = mmap(
+                nullptr,
+                reserved,
+                PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS,
+                -1,
+                0
+        );
+        if (raw == MAP_FAILED)
+        {
+            return nullptr;
+        }
+
+        const auto rawBegin = reinterpret_cast<uintptr_t>(raw);
+        const auto begin = (rawBegin + huge_page_size - 1) & ~uintptr_t(huge_page_size - 1);
+        const auto end = begin + mapped;
+
+        if (begin != rawBegin)
+        {
+            munmap(raw, begin - rawBegin);
+        }
+        if (end != rawBegin + reserved)
+        {
+            munmap(reinterpret_cast<void*>(end), rawBegin + reserved - end);
+        }
+
+    #if defined(MADV_HUGEPAGE)
+        // Failure is not an error: memory is backed by the regular pages
+        madvise(reinterpret_cast<void*>(begin), mapped, MADV_HUGEPAGE);
+    #endif
+
+        return reinterpret_cast<void*>(begin);
+#else
+        return aligned_allocate(mapped, huge_page_size);
+#endif
+    }
+
+    /// @brief Frees memory allocated by huge_page_allocate
+    inline void huge_page_free(void* memory, size_t mapped) noexcept
+    {
+#if defined(__linux__)
+        munmap(memory, mapped);
+#else
+        static_cast<void>(mapped);
+        aligned_free(memory);
+#endif
+    }
+}}
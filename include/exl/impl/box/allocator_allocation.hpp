@@ -0,0 +1,145 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include <exl/impl/exceptions.hpp>
+
+namespace exl { namespace impl
+{
+    /// @brief Allocates and constructs exl::box values with the allocator. Allocation failure
+    /// is reported as nullptr: exceptions thrown by the allocator are not propagated
+    template <typename Allocator>
+    struct allocator_allocation
+    {
+    public:
+        using traits_t = std::allocator_traits<Allocator>;
+        using value_t = typename traits_t::value_type;
+
+        static_assert(
+                std::is_same<typename traits_t::pointer, value_t*>::value,
+                "exl::box supports only allocators with raw pointers"
+        );
+
+    public:
+        /// @brief Allocates and constructs single value
+        /// @return Pointer to the value or nullptr when allocation has failed
+        template <typename ... Args>
+        static value_t* make(Allocator& allocator, Args&& ... args)
+        noexcept(std::is_nothrow_constructible<value_t, Args...>::value)
+        {
+            rollback guard(allocator, allocate(allocator, 1), 1);
+            if (guard.get() != nullptr)
+            {
+                traits_t::construct(allocator, guard.get(), std::forward<Args>(args)...);
+                guard.constructed();
+            }
+
+            return guard.release();
+        }
+
+        /// @brief Allocates array and value-initializes its elements
+        /// @return Pointer to the first element or nullptr when allocation has failed
+        static value_t* make_array(Allocator& allocator, size_t count)
+        noexcept(std::is_nothrow_default_constructible<value_t>::value)
+        {
+            rollback guard(allocator, allocate(allocator, count), count);
+            if (guard.get() != nullptr)
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    traits_t::construct(allocator, guard.get() + i);
+                    guard.constructed();
+                }
+            }
+
+            return guard.release();
+        }
+
+        /// @brief Destroys first constructed elements of the array of count elements and
+        /// returns its memory to the allocator
+        static void destroy(
+                Allocator& allocator,
+                value_t* ptr,
+                size_t constructed,
+                size_t count
+        ) noexcept
+        {
+            for (size_t i = constructed; i > 0; --i)
+            {
+                traits_t::destroy(allocator, ptr + i - 1);
+            }
+            traits_t::deallocate(allocator, ptr, count);
+        }
+
+    private:
+        /// @brief Rolls back partially constructed allocation when constructor throws
+        class rollback
+        {
+        public:
+            rollback(Allocator& allocator, value_t* ptr, size_t count) noexcept
+                    : allocator_(allocator)
+                    , ptr_(ptr)
+                    , count_(count)
+                    , constructed_(0) {}
+
+            rollback(const rollback&) = delete;
+            rollback& operator=(const rollback&) = delete;
+
+            ~rollback() noexcept
+            {
+                if (ptr_ != nullptr)
+                {
+                    destroy(allocator_, ptr_, constructed_, count_);
+                }
+            }
+
+            value_t* get() const noexcept
+            {
+                return ptr_;
+            }
+
+            void constructed() noexcept
+            {
+                ++constructed_;
+            }
+
+            value_t* release() noexcept
+            {
+                value_t* ptr = ptr_;
+                ptr_ = nullptr;
+                return ptr;
+            }
+
+        private:
+            Allocator& allocator_;
+            value_t* ptr_;
+            size_t count_;
+            size_t constructed_;
+        };
+
+    private:
+        static value_t* allocate(Allocator& allocator, size_t count) noexcept
+        {
+#if EXL_EXCEPTIONS
+            try
+            {
+                return traits_t::allocate(allocator, count);
+            }
+            catch (...)
+            {
+                return nullptr;
+            }
+#else
+            return traits_t::allocate(allocator, count);
+#endif
+        }
+    };
+}}
@@ -77,6 +77,8 @@ namespace exl { namespace impl
 
         void swap(boxed_ptr& rhs) noexcept
         {
+            // Stateful deleters (e.g. allocator deleters) should stay with their pointers
+            std::swap(static_cast<Deleter&>(*this), static_cast<Deleter&>(rhs));
             std::swap(ptr_, rhs.ptr_);
         }
 
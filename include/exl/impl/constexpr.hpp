@@ -0,0 +1,25 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+// C++14 relaxed constexpr (multiple statements and mutation in constexpr functions). exl itself
+// is written in C++11, functions which require relaxed constexpr are constexpr only when exl
+// is used from C++14 or later
+
+#if __cplusplus >= 201402L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201402L)
+
+/// @brief True when exl is compiled as C++14 or later
+#define EXL_HAS_CONSTEXPR14 1
+
+/// @brief Expands to constexpr when relaxed constexpr is supported
+#define EXL_CONSTEXPR14 constexpr
+
+#else
+
+#define EXL_HAS_CONSTEXPR14 0
+#define EXL_CONSTEXPR14
+
+#endif
@@ -0,0 +1,21 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+// exl never throws, but standard facilities used by exl (std::thread, allocators) report
+// failures with exceptions. Such exceptions are caught and converted to the exl failure values
+// only when exceptions are enabled
+
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+
+/// @brief True when code is compiled with exceptions enabled
+#define EXL_EXCEPTIONS 1
+
+#else
+
+#define EXL_EXCEPTIONS 0
+
+#endif
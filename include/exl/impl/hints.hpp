@@ -0,0 +1,34 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+// Branch prediction and code placement hints. Expand to the plain expressions on the compilers
+// which don't support them
+
+#if defined(__GNUC__) || defined(__clang__)
+
+/// @brief Marks condition as likely to be true
+#define EXL_LIKELY(condition) __builtin_expect(!!(condition), 1)
+
+/// @brief Marks condition as unlikely to be true
+#define EXL_UNLIKELY(condition) __builtin_expect(!!(condition), 0)
+
+/// @brief Marks function as rarely called: it is never inlined and is placed out of the hot code
+#define EXL_COLD __attribute__((cold, noinline))
+
+#elif defined(_MSC_VER)
+
+#define EXL_LIKELY(condition) (condition)
+#define EXL_UNLIKELY(condition) (condition)
+#define EXL_COLD __declspec(noinline)
+
+#else
+
+#define EXL_LIKELY(condition) (condition)
+#define EXL_UNLIKELY(condition) (condition)
+#define EXL_COLD
+
+#endif
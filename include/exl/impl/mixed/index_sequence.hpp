@@ -0,0 +1,58 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <cstddef>
+
+namespace exl { namespace impl
+{
+    /// @brief Compile-time sequence of indices (C++11 substitution for std::index_sequence)
+    template <size_t ... Indices>
+    struct index_sequence
+    {
+        static constexpr size_t size()
+        {
+            return sizeof...(Indices);
+        }
+    };
+
+    /// @brief Concatenates two index sequences, shifting indices of the second one by the size of
+    /// the first one
+    template <typename Lhs, typename Rhs>
+    struct index_sequence_concat;
+
+    template <size_t ... Lhs, size_t ... Rhs>
+    struct index_sequence_concat<index_sequence<Lhs...>, index_sequence<Rhs...>>
+    {
+        using type = index_sequence<Lhs..., (sizeof...(Lhs) + Rhs)...>;
+    };
+
+    /// @brief Generates index_sequence<0, 1, ..., N - 1>. Sequence is built by halves, so
+    /// instantiation depth is logarithmic
+    template <size_t N>
+    struct make_index_sequence_impl
+    {
+        using type = typename index_sequence_concat<
+                typename make_index_sequence_impl<N / 2>::type,
+                typename make_index_sequence_impl<N - N / 2>::type
+        >::type;
+    };
+
+    template <>
+    struct make_index_sequence_impl<0>
+    {
+        using type = index_sequence<>;
+    };
+
+    template <>
+    struct make_index_sequence_impl<1>
+    {
+        using type = index_sequence<0>;
+    };
+
+    template <size_t N>
+    using make_index_sequence = typename make_index_sequence_impl<N>::type;
+}}
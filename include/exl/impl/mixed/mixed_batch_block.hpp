@@ -0,0 +1,110 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include <exl/impl/mixed/type_list.hpp>
+
+namespace exl { namespace impl
+{
+    /// @brief Block of the exl::mixed values range partitioned by type ids (see
+    /// exl::match_batch).
+    ///
+    /// Up to block capacity values are visited once to collect their addresses and tags, then
+    /// positions of the values are grouped by tag with the counting sort. Block is small enough
+    /// to keep the following per-group passes in cache and requires no dynamic allocation.
+    /// Values of the same type keep their relative order
+    ///
+    /// @tparam Mixed exl::mixed type of the values, const-qualified for the read-only ranges
+    template <typename Mixed>
+    class mixed_batch_block
+    {
+    public:
+        using storage_type_list_t = typename std::remove_const<Mixed>::type::storage_type_list_t;
+        using tag_t = typename std::remove_const<Mixed>::type::tag_t;
+        using position_t = uint8_t;
+
+        static constexpr size_t capacity = size_t(1) << (8 * sizeof(position_t));
+
+    public:
+        /// @brief Fills block with the values from the beginning of the range
+        /// @return Iterator past the last value taken to the block
+        template <typename Iterator>
+        Iterator fill(Iterator first, Iterator last) noexcept
+        {
+            tag_t tags[capacity];
+
+            size_ = 0;
+            for (; first != last && size_ < capacity; ++first, ++size_)
+            {
+                Mixed& value = *first;
+                values_[size_] = &value;
+                tags[size_] = value.tag();
+            }
+
+            group_by_tag(tags);
+            return first;
+        }
+
+        /// @brief Returns count of the values in the block
+        size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        /// @brief Returns value at the specified position of the block
+        Mixed& value(position_t position) const noexcept
+        {
+            return *values_[position];
+        }
+
+        /// @brief Returns pointer to the first position of the values with specified type id
+        const position_t* bucket_begin(type_list_tag_t tag) const noexcept
+        {
+            return positions_ + offsets_[tag];
+        }
+
+        /// @brief Returns pointer past the last position of the values with specified type id
+        const position_t* bucket_end(type_list_tag_t tag) const noexcept
+        {
+            return positions_ + offsets_[tag + 1];
+        }
+
+    private:
+        static constexpr size_t types_count = type_list_get_size<storage_type_list_t>::value();
+
+    private:
+        void group_by_tag(const tag_t* tags) noexcept
+        {
+            offsets_.fill(0);
+            for (size_t i = 0; i < size_; ++i)
+            {
+                ++offsets_[size_t(tags[i]) + 1];
+            }
+
+            for (size_t i = 1; i < offsets_.size(); ++i)
+            {
+                offsets_[i] = uint16_t(offsets_[i] + offsets_[i - 1]);
+            }
+
+            auto cursors = offsets_;
+            for (size_t i = 0; i < size_; ++i)
+            {
+                positions_[cursors[tags[i]]++] = position_t(i);
+            }
+        }
+
+    private:
+        Mixed* values_[capacity];
+        position_t positions_[capacity];
+        std::array<uint16_t, types_count + 1> offsets_;
+        size_t size_ = 0;
+    };
+}}
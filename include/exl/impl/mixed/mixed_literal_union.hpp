@@ -0,0 +1,162 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+#include <exl/in_place.hpp>
+
+#include <exl/impl/constexpr.hpp>
+#include <exl/impl/mixed/type_list.hpp>
+
+namespace exl { namespace impl
+{
+    /// @brief Checks if exl::mixed with specified storage type list can be stored in the
+    /// mixed_literal_union, which allows to construct, query and map values at compile time.
+    ///
+    /// Requires trivially copyable variants. Union size is rounded up to its alignment, so the
+    /// union is used only when the largest variant leaves no tail padding for the tag: layout of
+    /// exl::mixed is the same for both storages. Selection doesn't depend on the language
+    /// standard, so translation units built with different -std agree on the storage type (only
+    /// the compile-time use of the union requires C++14)
+    template <typename TL>
+    struct mixed_is_literal_storage
+    {
+        static constexpr bool value()
+        {
+            return type_list_all_of<TL, std::is_trivially_copyable>::value()
+                    && type_list_get_max_sizeof<TL>::value()
+                            % type_list_get_max_alignof<TL>::value() == 0;
+        }
+    };
+
+    /// @brief Applies constness of Self to T
+    template <typename Self, typename T>
+    using mixed_literal_qualified_t = typename std::conditional<
+            std::is_const<Self>::value,
+            const T,
+            T
+    >::type;
+
+    /// @brief Recursive union of exl::mixed variants. Unlike the raw storage with placement new,
+    /// union members can be constructed and accessed in constant expressions. Members are
+    /// accessed at the same address as in the raw storage, so the union is used as the raw
+    /// storage by the runtime operations of exl::mixed
+    template <typename ... Types>
+    union mixed_literal_union;
+
+    template <>
+    union mixed_literal_union<>
+    {
+    public:
+        template <typename T, typename Self>
+        static EXL_CONSTEXPR14 mixed_literal_qualified_t<Self, T>& get(Self&) noexcept
+        {
+            std::terminate();
+        }
+
+        template <typename U, typename Self>
+        static EXL_CONSTEXPR14 mixed_literal_qualified_t<Self, U>& get_derived(
+                Self&,
+                type_list_tag_t
+        ) noexcept
+        {
+            std::terminate();
+        }
+    };
+
+    template <typename Head, typename ... Tail>
+    union mixed_literal_union<Head, Tail...>
+    {
+    public:
+        using tail_t = mixed_literal_union<Tail...>;
+
+    public:
+        constexpr mixed_literal_union() noexcept
+                : tail_() {}
+
+        template <typename ... Args>
+        constexpr explicit mixed_literal_union(in_place_type_t<Head>, Args&& ... args)
+                : head_(std::forward<Args>(args)...) {}
+
+        template <typename T, typename ... Args>
+        constexpr explicit mixed_literal_union(in_place_type_t<T> type, Args&& ... args)
+                : tail_(type, std::forward<Args>(args)...) {}
+
+        /// @brief Returns member of type T
+        template <typename T, typename Self>
+        static constexpr mixed_literal_qualified_t<Self, T>& get(Self& self) noexcept
+        {
+            return get<T>(self, std::is_same<T, Head>());
+        }
+
+        /// @brief Returns member with the specified type id as U, which is the member type or
+        /// its base
+        template <typename U, typename Self>
+        static constexpr mixed_literal_qualified_t<Self, U>& get_derived(
+                Self& self,
+                type_list_tag_t tag
+        ) noexcept
+        {
+            return get_derived<U>(
+                    self,
+                    tag,
+                    std::integral_constant<
+                            bool,
+                            std::is_same<U, Head>::value || std::is_base_of<U, Head>::value
+                    >()
+            );
+        }
+
+    public:
+        Head head_;
+        tail_t tail_;
+
+    private:
+        template <typename T, typename Self>
+        static constexpr mixed_literal_qualified_t<Self, T>& get(
+                Self& self,
+                std::true_type
+        ) noexcept
+        {
+            return self.head_;
+        }
+
+        template <typename T, typename Self>
+        static constexpr mixed_literal_qualified_t<Self, T>& get(
+                Self& self,
+                std::false_type
+        ) noexcept
+        {
+            return tail_t::template get<T>(self.tail_);
+        }
+
+        // Head type has the largest id, see type_list_get_type_id
+        template <typename U, typename Self>
+        static constexpr mixed_literal_qualified_t<Self, U>& get_derived(
+                Self& self,
+                type_list_tag_t tag,
+                std::true_type
+        ) noexcept
+        {
+            return tag == sizeof...(Tail)
+                    ? static_cast<mixed_literal_qualified_t<Self, U>&>(self.head_)
+                    : tail_t::template get_derived<U>(self.tail_, tag);
+        }
+
+        template <typename U, typename Self>
+        static constexpr mixed_literal_qualified_t<Self, U>& get_derived(
+                Self& self,
+                type_list_tag_t tag,
+                std::false_type
+        ) noexcept
+        {
+            return tail_t::template get_derived<U>(self.tail_, tag);
+        }
+    };
+}}
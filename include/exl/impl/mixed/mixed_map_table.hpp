@@ -0,0 +1,230 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+#include <exl/matchers.hpp>
+#include <exl/impl/mixed/mixed_slot.hpp>
+#include <exl/impl/mixed/type_list.hpp>
+
+namespace exl { namespace impl
+{
+    /// @brief Checks if matcher accepts value of type T. Semantics are the same as for the
+    /// exl::mixed::is (exl::when), exl::mixed::is_exact (exl::when_exact) checks.
+    /// exl::otherwise accepts any type
+    template <typename Matcher, typename T, typename Kind = typename Matcher::kind_t>
+    struct mixed_matcher_accepts;
+
+    template <typename Matcher, typename T>
+    struct mixed_matcher_accepts<Matcher, T, marker::matcher_when>
+    {
+        static constexpr bool value()
+        {
+            return std::is_same<typename Matcher::target_type_t, T>::value
+                    || std::is_base_of<typename Matcher::target_type_t, T>::value;
+        }
+    };
+
+    template <typename Matcher, typename T>
+    struct mixed_matcher_accepts<Matcher, T, marker::matcher_when_exact>
+    {
+        static constexpr bool value()
+        {
+            return std::is_same<typename Matcher::target_type_t, T>::value;
+        }
+    };
+
+    template <typename Matcher, typename T>
+    struct mixed_matcher_accepts<Matcher, T, marker::matcher_otherwise>
+    {
+        static constexpr bool value()
+        {
+            return true;
+        }
+    };
+
+    /// @brief Returns index of the first matcher which accepts value of type T or matchers count
+    /// if there is no such matcher
+    template <typename T, typename ... Matchers>
+    struct mixed_matcher_select;
+
+    template <typename T>
+    struct mixed_matcher_select<T>
+    {
+        static constexpr size_t value()
+        {
+            return 0;
+        }
+    };
+
+    template <typename T, typename Head, typename ... Tail>
+    struct mixed_matcher_select<T, Head, Tail...>
+    {
+        static constexpr size_t value()
+        {
+            return mixed_matcher_accepts<typename std::decay<Head>::type, T>::value()
+                    ? 0
+                    : 1 + mixed_matcher_select<T, Tail...>::value();
+        }
+    };
+
+    /// @brief Checks that exl::otherwise matcher (if any) is the last one
+    template <typename ... Matchers>
+    struct mixed_matcher_otherwise_is_last;
+
+    template <>
+    struct mixed_matcher_otherwise_is_last<>
+    {
+        static constexpr bool value()
+        {
+            return true;
+        }
+    };
+
+    template <typename Head, typename ... Tail>
+    struct mixed_matcher_otherwise_is_last<Head, Tail...>
+    {
+        static constexpr bool value()
+        {
+            return (sizeof...(Tail) == 0 || !std::is_same<
+                    typename std::decay<Head>::type::kind_t,
+                    marker::matcher_otherwise
+            >::value) && mixed_matcher_otherwise_is_last<Tail...>::value();
+        }
+    };
+
+    /// @brief Returns reference to To with the same constness and value category as the
+    /// reference From (e.g. const To& for const From&, To&& for From&&)
+    template <typename From, typename To>
+    struct mixed_forward_like
+    {
+        using type = To&&;
+    };
+
+    template <typename From, typename To>
+    struct mixed_forward_like<From&, To>
+    {
+        using type = typename std::conditional<std::is_const<From>::value, const To&, To&>::type;
+    };
+
+    template <typename From, typename To>
+    struct mixed_forward_like<From&&, To>
+    {
+        using type = typename std::conditional<
+                std::is_const<From>::value,
+                const To&&,
+                To&&
+        >::type;
+    };
+
+    template <typename From, typename To>
+    using mixed_forward_like_t = typename mixed_forward_like<From, To>::type;
+
+    /// @brief Invokes matcher functor with the value of type T, preserving its constness and
+    /// value category
+    template <typename Kind>
+    struct mixed_matcher_invoke
+    {
+        template <typename U, typename Matcher, typename T>
+        static U call(Matcher& matcher, T&& value)
+        {
+            using Target = typename Matcher::target_type_t;
+            return static_cast<U>(matcher.impl(
+                    static_cast<mixed_forward_like_t<T&&, Target>>(value)
+            ));
+        }
+    };
+
+    template <>
+    struct mixed_matcher_invoke<marker::matcher_otherwise>
+    {
+        template <typename U, typename Matcher, typename T>
+        static U call(Matcher& matcher, T&&)
+        {
+            return static_cast<U>(matcher.impl());
+        }
+    };
+
+    /// @brief Performs exl::mixed::map dispatch using the table of functions.
+    ///
+    /// Matcher which handles each of the type list types is selected at compile time (first
+    /// matcher which accepts the type wins, as for the sequential matching), so the map costs
+    /// single indirect call regardless of the matchers count and type list size
+    ///
+    /// @tparam U Return type of the map expression
+    /// @tparam TL Type list of the mixed storage slots (see mixed_slot_traits)
+    /// @tparam Matchers Matcher types
+    template <typename U, typename TL, typename ... Matchers>
+    struct mixed_map_table;
+
+    template <typename U, typename ... Types, typename ... Matchers>
+    struct mixed_map_table<U, type_list<Types...>, Matchers...>
+    {
+    public:
+        using result_t = U;
+        using matchers_t = std::tuple<typename std::decay<Matchers>::type...>;
+
+        static_assert(
+                mixed_matcher_otherwise_is_last<Matchers...>::value(),
+                "exl::otherwise should be the last matcher"
+        );
+
+    public:
+        /// @brief Invokes matcher selected for the type with specified tag
+        /// @tparam Qualified Reference to the storage type, which defines constness and value
+        /// category of the values passed to the matchers (const Storage&, Storage& or Storage&&)
+        template <typename Qualified>
+        static U dispatch(
+                typename std::remove_reference<Qualified>::type& storage,
+                type_list_tag_t tag,
+                matchers_t& matchers
+        ) noexcept
+        {
+            using Func = U (*)(typename std::remove_reference<Qualified>::type&, matchers_t&);
+            static constexpr Func table[] = { &call_as<Qualified, Types>... };
+
+            return table[type_list_index_of_tag(sizeof...(Types), tag)](storage, matchers);
+        }
+
+        /// @brief Invokes matcher selected for the stored slot type T directly (without the
+        /// table). see mixed_map_table::dispatch
+        template <typename Qualified, typename T>
+        static U call_as(
+                typename std::remove_reference<Qualified>::type& storage,
+                matchers_t& matchers
+        )
+        {
+            using Storage = typename std::remove_reference<Qualified>::type;
+            using Slot = typename std::conditional<std::is_const<Storage>::value, const T, T>::type;
+            using Value = typename mixed_slot_traits<T>::value_t;
+
+            constexpr size_t index = mixed_matcher_select<Value, Matchers...>::value();
+            static_assert(
+                    index < sizeof...(Matchers),
+                    "exl::mixed::map matchers should cover all types"
+            );
+
+            using Matcher = typename std::decay<
+                    typename std::tuple_element<index, std::tuple<Matchers...>>::type
+            >::type;
+
+            return mixed_matcher_invoke<typename Matcher::kind_t>::template call<U>(
+                    std::get<index>(matchers),
+                    static_cast<mixed_forward_like_t<Qualified, Value>>(
+                            mixed_slot_traits<T>::get(reinterpret_cast<Slot&>(storage))
+                    )
+            );
+        }
+    };
+
+    /// @brief Minimal type list size for which exl::mixed::map uses table dispatch instead of
+    /// the sequential matchers check: from this size the table is faster on the unpredictable
+    /// tags, while the chain advantage on the predictable tags becomes small
+    constexpr size_t mixed_map_table_min_size = 32;
+}}
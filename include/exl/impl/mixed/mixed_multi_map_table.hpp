@@ -0,0 +1,319 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+#include <exl/matchers.hpp>
+#include <exl/mixed.hpp>
+#include <exl/impl/mixed/index_sequence.hpp>
+#include <exl/impl/mixed/mixed_map_table.hpp>
+#include <exl/impl/mixed/type_list.hpp>
+
+namespace exl { namespace impl
+{
+    /// @brief Returns exl::mixed base type of exl::mixed or derived type (e.g. exl::option)
+    template <typename ... Types>
+    mixed<Types...> mixed_base_type_of(const mixed<Types...>*);
+
+    template <typename T>
+    using mixed_base_type_t = decltype(mixed_base_type_of(static_cast<const T*>(nullptr)));
+
+    /// @brief Returns count of the leading arguments, which are exl::mixed values
+    template <typename ... Args>
+    struct mixed_leading_count;
+
+    template <>
+    struct mixed_leading_count<>
+    {
+        static constexpr size_t value()
+        {
+            return 0;
+        }
+    };
+
+    template <typename Head, typename ... Tail>
+    struct mixed_leading_count<Head, Tail...>
+    {
+        static constexpr size_t value()
+        {
+            return std::is_base_of<marker::mixed, typename std::decay<Head>::type>::value
+                    ? 1 + mixed_leading_count<Tail...>::value()
+                    : 0;
+        }
+    };
+
+    /// @brief Returns product of the type lists sizes
+    template <typename ... TLs>
+    struct type_lists_size_product;
+
+    template <>
+    struct type_lists_size_product<>
+    {
+        static constexpr size_t value()
+        {
+            return 1;
+        }
+    };
+
+    template <typename TL, typename ... Tail>
+    struct type_lists_size_product<TL, Tail...>
+    {
+        static constexpr size_t value()
+        {
+            return type_list_get_size<TL>::value() * type_lists_size_product<Tail...>::value();
+        }
+    };
+
+    /// @brief Decodes flat index of the type lists cartesian product to the list of types. Index
+    /// is row-major: index of the last type list changes fastest
+    template <size_t Index, typename ... TLs>
+    struct type_lists_product_at;
+
+    template <size_t Index, typename TL>
+    struct type_lists_product_at<Index, TL>
+    {
+        using type = type_list<type_list_get_type_at<TL, Index>>;
+    };
+
+    template <size_t Index, typename TL, typename ... Tail>
+    struct type_lists_product_at<Index, TL, Tail...>
+    {
+    private:
+        static constexpr size_t stride = type_lists_size_product<Tail...>::value();
+
+    public:
+        using type = typename type_list_push_front<
+                typename type_lists_product_at<Index % stride, Tail...>::type,
+                type_list_get_type_at<TL, Index / stride>
+        >::type;
+    };
+
+    /// @brief Checks if multi-value matcher accepts the combination of types
+    template <
+            typename Matcher,
+            typename TypesTL,
+            typename Kind = typename Matcher::kind_t,
+            typename TargetsTL = typename Matcher::target_type_t
+    >
+    struct mixed_multi_matcher_accepts;
+
+    template <typename Matcher, typename ... Types, typename ... Targets>
+    struct mixed_multi_matcher_accepts<
+            Matcher,
+            type_list<Types...>,
+            marker::matcher_when_all,
+            type_list<Targets...>
+    >
+    {
+        static_assert(
+                sizeof...(Types) == sizeof...(Targets),
+                "exl::when_all types count should be equal to the matched values count"
+        );
+
+        static constexpr bool value()
+        {
+            return type_list_bool_all_of<
+                    (std::is_same<Targets, Types>::value
+                            || std::is_base_of<Targets, Types>::value)...
+            >::value();
+        }
+    };
+
+    template <typename Matcher, typename ... Types, typename ... Targets>
+    struct mixed_multi_matcher_accepts<
+            Matcher,
+            type_list<Types...>,
+            marker::matcher_when_all_exact,
+            type_list<Targets...>
+    >
+    {
+        static_assert(
+                sizeof...(Types) == sizeof...(Targets),
+                "exl::when_all_exact types count should be equal to the matched values count"
+        );
+
+        static constexpr bool value()
+        {
+            return type_list_bool_all_of<std::is_same<Targets, Types>::value...>::value();
+        }
+    };
+
+    template <typename Matcher, typename TypesTL>
+    struct mixed_multi_matcher_accepts<Matcher, TypesTL, marker::matcher_otherwise, void>
+    {
+        static constexpr bool value()
+        {
+            return true;
+        }
+    };
+
+    /// @brief Returns index of the first matcher which accepts the combination of types or
+    /// matchers count if there is no such matcher
+    template <typename TypesTL, typename ... Matchers>
+    struct mixed_multi_matcher_select;
+
+    template <typename TypesTL>
+    struct mixed_multi_matcher_select<TypesTL>
+    {
+        static constexpr size_t value()
+        {
+            return 0;
+        }
+    };
+
+    template <typename TypesTL, typename Head, typename ... Tail>
+    struct mixed_multi_matcher_select<TypesTL, Head, Tail...>
+    {
+        static constexpr size_t value()
+        {
+            return mixed_multi_matcher_accepts<Head, TypesTL>::value()
+                    ? 0
+                    : 1 + mixed_multi_matcher_select<TypesTL, Tail...>::value();
+        }
+    };
+
+    /// @brief Invokes multi-value matcher functor with the values of the specified types
+    template <typename Kind>
+    struct mixed_multi_matcher_invoke
+    {
+        template <typename U, typename ... Types, typename Matcher, typename ... Mixeds>
+        static U call(Matcher& matcher, const Mixeds& ... values)
+        {
+            return call_as<U, Types...>(
+                    static_cast<typename Matcher::target_type_t*>(nullptr),
+                    matcher,
+                    values...
+            );
+        }
+
+    private:
+        template <
+                typename U,
+                typename ... Types,
+                typename ... Targets,
+                typename Matcher,
+                typename ... Mixeds
+        >
+        static U call_as(type_list<Targets...>*, Matcher& matcher, const Mixeds& ... values)
+        {
+            return static_cast<U>(matcher.impl(static_cast<const Targets&>(
+                    mixed_access::unsafe_unwrap<Types>(values)
+            )...));
+        }
+    };
+
+    template <>
+    struct mixed_multi_matcher_invoke<marker::matcher_otherwise>
+    {
+        template <typename U, typename ... Types, typename Matcher, typename ... Mixeds>
+        static U call(Matcher& matcher, const Mixeds& ...)
+        {
+            return static_cast<U>(matcher.impl());
+        }
+    };
+
+    /// @brief Performs matching of multiple exl::mixed values using single flattened table of
+    /// functions, indexed by all values tags (cartesian product of the type lists).
+    ///
+    /// Matcher for each combination of types is selected at compile time (first matcher which
+    /// accepts all types wins), so the match costs single indirect call
+    ///
+    /// @tparam U Return type of the map expression
+    /// @tparam MixedsTL Type list of the exl::mixed types to match
+    /// @tparam MatchersTL Type list of the matcher types
+    template <typename U, typename MixedsTL, typename MatchersTL>
+    struct mixed_multi_map_table;
+
+    template <typename U, typename ... Mixeds, typename ... Matchers>
+    struct mixed_multi_map_table<U, type_list<Mixeds...>, type_list<Matchers...>>
+    {
+    public:
+        using matchers_t = std::tuple<typename std::decay<Matchers>::type...>;
+
+        static_assert(
+                mixed_matcher_otherwise_is_last<Matchers...>::value(),
+                "exl::otherwise should be the last matcher"
+        );
+
+    public:
+        static U dispatch(matchers_t& matchers, const Mixeds& ... values) noexcept
+        {
+            return table(make_index_sequence<table_size>())[flat_index(0, values...)](
+                    matchers,
+                    values...
+            );
+        }
+
+    private:
+        using Func = U (*)(matchers_t&, const Mixeds& ...);
+
+        static constexpr size_t table_size = type_lists_size_product<
+                typename Mixeds::type_list_t...
+        >::value();
+
+    private:
+        template <size_t ... Indices>
+        static const Func* table(index_sequence<Indices...>) noexcept
+        {
+            static constexpr Func entries[] = { &call_at<Indices>... };
+            return entries;
+        }
+
+        static size_t flat_index(size_t index) noexcept
+        {
+            return index;
+        }
+
+        // Table positions follow the type list order
+        template <typename Head, typename ... Tail>
+        static size_t flat_index(size_t index, const Head& head, const Tail& ... tail) noexcept
+        {
+            constexpr size_t size = type_list_get_size<typename Head::type_list_t>::value();
+
+            return flat_index(
+                    index * size + type_list_index_of_tag(size, head.tag()),
+                    tail...
+            );
+        }
+
+        template <size_t Index>
+        static U call_at(matchers_t& matchers, const Mixeds& ... values)
+        {
+            return call_as(
+                    static_cast<typename type_lists_product_at<
+                            Index,
+                            typename Mixeds::type_list_t...
+                    >::type*>(nullptr),
+                    matchers,
+                    values...
+            );
+        }
+
+        template <typename ... Types>
+        static U call_as(type_list<Types...>*, matchers_t& matchers, const Mixeds& ... values)
+        {
+            constexpr size_t index = mixed_multi_matcher_select<
+                    type_list<Types...>,
+                    typename std::decay<Matchers>::type...
+            >::value();
+
+            static_assert(
+                    index < sizeof...(Matchers),
+                    "exl::match matchers should cover all combinations of types"
+            );
+
+            using Matcher = typename std::tuple_element<index, matchers_t>::type;
+
+            return mixed_multi_matcher_invoke<typename Matcher::kind_t>::template call<
+                    U,
+                    Types...
+            >(std::get<index>(matchers), values...);
+        }
+    };
+}}
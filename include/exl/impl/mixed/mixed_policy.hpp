@@ -0,0 +1,63 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include <exl/inline_budget.hpp>
+#include <exl/niche_traits.hpp>
+#include <exl/none.hpp>
+
+#include <exl/impl/mixed/mixed_slot.hpp>
+#include <exl/impl/mixed/type_list.hpp>
+
+namespace exl { namespace impl
+{
+    /// @brief Splits exl::mixed template arguments into the storage policy and alternatives.
+    ///
+    /// Provides list of the alternatives (type_list_t) and list of the types actually kept in the
+    /// storage (storage_type_list_t). Type ids in both lists are the same
+    ///
+    /// @tparam Types exl::mixed template arguments
+    template <typename ... Types>
+    struct mixed_policy
+    {
+        using type_list_t = type_list<Types...>;
+        using storage_type_list_t = type_list_t;
+
+        template <typename T>
+        using slot_t = T;
+    };
+
+    template <size_t Size, typename ... Types>
+    struct mixed_policy<inline_budget<Size>, Types...>
+    {
+        template <typename T>
+        using slot_t = typename std::conditional<(sizeof(T) <= Size), T, mixed_boxed<T>>::type;
+
+        using type_list_t = type_list<Types...>;
+        using storage_type_list_t = type_list<slot_t<Types>...>;
+    };
+
+    /// @brief Storage policy of exl::option: exl::none is represented by the niche value of T
+    /// (see exl::niche_traits) when T declares it. Not an alternative itself
+    struct mixed_option_policy {};
+
+    template <typename T>
+    struct mixed_policy<mixed_option_policy, T, exl::none>
+    {
+        template <typename U>
+        using slot_t = typename std::conditional<
+                std::is_same<U, exl::none>::value && niche_traits<T>::has_niche(),
+                mixed_niche_none,
+                U
+        >::type;
+
+        using type_list_t = type_list<T, exl::none>;
+        using storage_type_list_t = type_list<T, slot_t<exl::none>>;
+    };
+}}
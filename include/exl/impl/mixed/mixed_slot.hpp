@@ -0,0 +1,296 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <new>
+#include <cstddef>
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+#include <exl/box.hpp>
+#include <exl/in_place.hpp>
+#include <exl/none.hpp>
+#include <exl/relocate.hpp>
+
+#include <exl/impl/hints.hpp>
+#include <exl/impl/mixed/type_list.hpp>
+
+namespace exl { namespace impl
+{
+    /// @brief Describes how the alternative is kept in the exl::mixed storage ("slot") and which
+    /// value is presented to the users of exl::mixed. Plain alternatives are stored as is,
+    /// slots which keep their payload out of line (see mixed_boxed) specialize this template
+    /// @tparam Slot Type stored in the exl::mixed storage
+    template <typename Slot>
+    struct mixed_slot_traits
+    {
+        using value_t = Slot;
+
+        /// @brief Constructs slot from the alternative constructor arguments
+        template <typename ... Args>
+        static void construct(void* storage, Args&& ... args)
+        {
+            new(storage) (Slot)(std::forward<Args>(args)...);
+        }
+
+        static Slot& get(Slot& slot) noexcept
+        {
+            return slot;
+        }
+
+        static const Slot& get(const Slot& slot) noexcept
+        {
+            return slot;
+        }
+    };
+
+    /// @brief Slot which keeps the alternative in the heap.
+    ///
+    /// Alternative is allocated only when it is constructed or copied, move transfers the
+    /// ownership without allocation. Moved-from slot is left empty: it can be copied (copy is
+    /// empty as well), assigned and destroyed, access to its alternative calls std::terminate
+    /// as for the invalid exl::box. Failed allocation calls std::terminate
+    ///
+    /// @tparam T Alternative type
+    template <typename T>
+    class mixed_boxed
+    {
+    public:
+        /// @brief Allocates alternative constructed in-place from the provided arguments
+        template <typename ... Args>
+        explicit mixed_boxed(in_place_type_t<T>, Args&& ... args)
+                : value_(make(std::forward<Args>(args)...)) {}
+
+        mixed_boxed(const mixed_boxed& rhs)
+                : value_(rhs.is_empty() ? box<T>(nullptr) : make(rhs.get())) {}
+
+        mixed_boxed(mixed_boxed&& rhs) noexcept
+                : value_(std::move(rhs.value_)) {}
+
+        mixed_boxed& operator=(const mixed_boxed& rhs)
+        {
+            if (rhs.is_empty())
+            {
+                value_.reset(nullptr);
+            }
+            else if (is_empty())
+            {
+                value_ = make(rhs.get());
+            }
+            else
+            {
+                *value_ = rhs.get();
+            }
+
+            return *this;
+        }
+
+        mixed_boxed& operator=(mixed_boxed&& rhs) noexcept
+        {
+            value_ = std::move(rhs.value_);
+            return *this;
+        }
+
+        /// @brief Returns true if the alternative has been moved out of the slot
+        bool is_empty() const noexcept
+        {
+            return !value_.is_valid();
+        }
+
+        /// @brief Returns reference to the alternative. Calls std::terminate if slot is empty
+        T& get() noexcept
+        {
+            return *value_;
+        }
+
+        /// @brief Returns const reference to the alternative. Calls std::terminate if slot is
+        /// empty
+        const T& get() const noexcept
+        {
+            return *value_;
+        }
+
+    private:
+        template <typename ... Args>
+        EXL_COLD static box<T> make(Args&& ... args)
+        {
+            auto value = box<T>::make(std::forward<Args>(args)...);
+
+            if (!value.is_valid())
+            {
+                std::terminate();
+            }
+
+            return value;
+        }
+
+    private:
+        box<T> value_;
+    };
+
+    template <typename T>
+    struct mixed_slot_traits<mixed_boxed<T>>
+    {
+        using value_t = T;
+
+        template <typename ... Args>
+        static void construct(void* storage, Args&& ... args)
+        {
+            new(storage) mixed_boxed<T>(in_place_type_t<T>(), std::forward<Args>(args)...);
+        }
+
+        static T& get(mixed_boxed<T>& slot) noexcept
+        {
+            return slot.get();
+        }
+
+        static const T& get(const mixed_boxed<T>& slot) noexcept
+        {
+            return slot.get();
+        }
+    };
+
+    /// @brief Slot of exl::none in exl::option<T> when T has the niche value (see
+    /// exl::niche_traits). Selects the storage which represents exl::none by the niche value of
+    /// T, plain exl::mixed<T, exl::none> keeps exl::none in the separate slot, so the niche value
+    /// stored in it is still the value of type T
+    struct mixed_niche_none : exl::none {};
+
+    template <>
+    struct mixed_slot_traits<mixed_niche_none>
+    {
+        using value_t = exl::none;
+
+        template <typename ... Args>
+        static void construct(void* storage, Args&& ...)
+        {
+            new(storage) mixed_niche_none();
+        }
+
+        static exl::none& get(mixed_niche_none& slot) noexcept
+        {
+            return slot;
+        }
+
+        static const exl::none& get(const mixed_niche_none& slot) noexcept
+        {
+            return slot;
+        }
+    };
+
+    /// @brief Returns storage type list in which slots which differ only by the layout of the
+    /// storage (mixed_niche_none) are replaced by their alternatives. Storages with the same
+    /// conversion type list are converted into each other
+    template <typename StorageTL>
+    struct mixed_conversion_type_list;
+
+    template <typename ... Slots>
+    struct mixed_conversion_type_list<type_list<Slots...>>
+    {
+        using type = type_list<typename std::conditional<
+                std::is_same<Slots, mixed_niche_none>::value,
+                exl::none,
+                Slots
+        >::type...>;
+    };
+
+    /// @brief Checks if the value of slot type Slot is accessible as U (same type or derived
+    /// from it, as for exl::mixed::is)
+    template <typename U, typename Slot>
+    struct mixed_slot_accepts
+    {
+        static constexpr bool value()
+        {
+            return std::is_same<U, typename mixed_slot_traits<Slot>::value_t>::value
+                    || std::is_base_of<U, typename mixed_slot_traits<Slot>::value_t>::value;
+        }
+    };
+
+    /// @brief Returns reference to the value of slot type Slot as U
+    template <typename U, typename Slot, bool = mixed_slot_accepts<U, Slot>::value()>
+    struct mixed_slot_cast_entry
+    {
+        static U& get(void* storage) noexcept
+        {
+            return static_cast<U&>(mixed_slot_traits<Slot>::get(*static_cast<Slot*>(storage)));
+        }
+    };
+
+    template <typename U, typename Slot>
+    struct mixed_slot_cast_entry<U, Slot, false>
+    {
+        static U& get(void*) noexcept
+        {
+            std::terminate();
+        }
+    };
+
+    /// @brief Provides access to the stored value as U, where U is the stored type or its base.
+    ///
+    /// When all slots accepted as U keep their values inline, value is accessed at the storage
+    /// address directly. Otherwise stored slot is resolved by the tag through the table of
+    /// functions
+    ///
+    /// @tparam U Requested type
+    /// @tparam StorageTL Type list of the storage slots
+    template <typename U, typename StorageTL>
+    struct mixed_slot_cast;
+
+    template <typename U, typename ... Slots>
+    struct mixed_slot_cast<U, type_list<Slots...>>
+    {
+    public:
+        static U& get(void* storage, type_list_tag_t tag) noexcept
+        {
+            return get(
+                    storage,
+                    tag,
+                    std::integral_constant<bool, type_list_bool_all_of<(
+                            !mixed_slot_accepts<U, Slots>::value() || std::is_same<
+                                    Slots,
+                                    typename mixed_slot_traits<Slots>::value_t
+                            >::value
+                    )...>::value()>()
+            );
+        }
+
+    private:
+        static U& get(void* storage, type_list_tag_t, std::true_type) noexcept
+        {
+            return *static_cast<U*>(storage);
+        }
+
+        static U& get(void* storage, type_list_tag_t tag, std::false_type) noexcept
+        {
+            using Func = U& (*)(void*);
+            static constexpr Func table[] = { &mixed_slot_cast_entry<U, Slots>::get... };
+
+            return table[type_list_index_of_tag(sizeof...(Slots), tag)](storage);
+        }
+    };
+
+    /// @brief Checks if all slots of the exl::mixed storage are trivially relocatable (see
+    /// exl::is_trivially_relocatable)
+    template <typename StorageTL>
+    struct mixed_slots_trivially_relocatable;
+
+    template <typename ... Slots>
+    struct mixed_slots_trivially_relocatable<type_list<Slots...>>
+    {
+        static constexpr bool value() { return is_trivially_relocatable_all<Slots...>::value(); }
+    };
+}}
+
+namespace exl
+{
+    /// @brief Heap slot holds only the exl::box
+    template <typename T>
+    struct is_trivially_relocatable<impl::mixed_boxed<T>>
+    {
+        static constexpr bool value() { return is_trivially_relocatable<box<T>>::value(); }
+    };
+}
@@ -0,0 +1,638 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <new>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#include <exl/in_place.hpp>
+#include <exl/none.hpp>
+#include <exl/niche_traits.hpp>
+
+#include <exl/impl/constexpr.hpp>
+#include <exl/impl/mixed/type_list.hpp>
+#include <exl/impl/mixed/mixed_literal_union.hpp>
+#include <exl/impl/mixed/mixed_slot.hpp>
+#include <exl/impl/mixed/mixed_storage_operations.hpp>
+
+namespace exl { namespace impl
+{
+    /// @brief Marker type for mixed storage construction by copy of the subset storage
+    struct mixed_storage_copy_t {};
+
+    /// @brief Marker type for mixed storage construction by move of the subset storage
+    struct mixed_storage_move_t {};
+
+    /// @brief Marker type for mixed storage construction by move of the storage, which stored
+    /// value has the same type id and storage type in both storages. Other types of the source
+    /// storage are not required to be present in the destination type list
+    struct mixed_storage_move_same_id_t {};
+
+    /// @brief Checks if exl::mixed with specified storage type list is stored without separate
+    /// tag. Only exl::option selects it (see mixed_option_policy) when exl::niche_traits is
+    /// declared for the value type: niche value of the type represents exl::none
+    template <typename TL>
+    struct mixed_is_niche_optimizable
+    {
+        static constexpr bool value() { return false; }
+    };
+
+    template <typename T>
+    struct mixed_is_niche_optimizable<type_list<T, mixed_niche_none>>
+    {
+        static constexpr bool value() { return niche_traits<T>::has_niche(); }
+    };
+
+    /// @brief Maps type ids of the subset storage to the type ids of the storage (see
+    /// type_list_subset_id_mapping). Niche layout of exl::none doesn't affect the mapping
+    template <typename TL, typename RhsTL>
+    using mixed_storage_id_mapping = type_list_subset_id_mapping<
+            typename mixed_conversion_type_list<TL>::type,
+            typename mixed_conversion_type_list<RhsTL>::type
+    >;
+
+    /// @brief Checks if exl::mixed with specified type list keeps its values in the
+    /// mixed_literal_union instead of the raw storage
+    template <typename TL>
+    struct mixed_uses_literal_union
+    {
+        static constexpr bool value()
+        {
+            return !mixed_is_niche_optimizable<TL>::value()
+                    && mixed_is_literal_storage<TL>::value();
+        }
+    };
+
+    /// @brief Holds raw storage and tag of exl::mixed
+    ///
+    /// Tag should be changed with set_tag() only after construction of the new value
+    ///
+    /// @tparam TL Type list of the storage variants
+    template <
+            typename TL,
+            bool = mixed_is_niche_optimizable<TL>::value(),
+            bool = mixed_is_literal_storage<TL>::value()
+    >
+    struct mixed_tagged_storage
+    {
+    public:
+        // Raw byte array is used instead of std::aligned_storage, because the latter rounds its
+        // size up to the alignment. This way tag is placed into the storage tail padding.
+        using storage_t = unsigned char[type_list_get_max_sizeof<TL>::value()];
+        using storage_operations_t = mixed_storage_operations<TL, storage_t>;
+
+    public:
+        mixed_tagged_storage() noexcept
+                : tag_(0) {}
+
+        /// @brief Constructs slot of type T in-place (see mixed_slot_traits)
+        template <typename T, typename ... Args>
+        mixed_tagged_storage(
+                in_place_type_t<T>,
+                type_list_tag_t tag,
+                Args&& ... args
+        ) noexcept(std::is_nothrow_constructible<T, Args&&...>::value)
+        {
+            mixed_slot_traits<T>::construct(&storage_, std::forward<Args>(args)...);
+            set_tag(tag);
+        }
+
+        constexpr type_list_tag_t tag() const noexcept
+        {
+            return tag_;
+        }
+
+        void set_tag(type_list_tag_t tag) noexcept
+        {
+            tag_ = type_list_compact_tag_t<TL>(tag);
+        }
+
+        void destroy_value() noexcept
+        {
+            storage_operations_t::destroy(storage_, tag_);
+        }
+
+    public:
+        alignas(type_list_get_max_alignof<TL>::value()) storage_t storage_;
+        type_list_compact_tag_t<TL> tag_;
+    };
+
+    /// @brief Storage of exl::option-like type list without separate tag: exl::none is
+    /// represented by the niche value of T, so storage always holds alive object of type T.
+    ///
+    /// Niche is constructed and checked by exl::niche_traits on the raw storage, so this
+    /// storage is not usable in constant expressions even for the literal T
+    template <typename T, bool Literal>
+    struct mixed_tagged_storage<type_list<T, mixed_niche_none>, true, Literal>
+    {
+    public:
+        using storage_t = unsigned char[sizeof(T)];
+        using storage_operations_t = mixed_storage_operations<
+                type_list<T, mixed_niche_none>,
+                storage_t
+        >;
+
+    public:
+        mixed_tagged_storage() noexcept {}
+
+        template <typename Slot, typename ... Args>
+        mixed_tagged_storage(
+                in_place_type_t<Slot>,
+                type_list_tag_t tag,
+                Args&& ... args
+        ) noexcept(std::is_nothrow_constructible<Slot, Args&&...>::value)
+        {
+            mixed_slot_traits<Slot>::construct(&storage_, std::forward<Args>(args)...);
+            set_tag(tag);
+        }
+
+        type_list_tag_t tag() const noexcept
+        {
+            return niche_traits<T>::is_niche(reinterpret_cast<const T&>(storage_))
+                    ? none_tag()
+                    : value_tag();
+        }
+
+        void set_tag(type_list_tag_t tag) noexcept
+        {
+            if (tag == none_tag())
+            {
+                niche_traits<T>::construct_niche(&storage_);
+            }
+        }
+
+        void destroy_value() noexcept
+        {
+            reinterpret_cast<T*>(&storage_)->~T();
+        }
+
+    public:
+        alignas(T) storage_t storage_;
+
+    private:
+        static constexpr type_list_tag_t none_tag()
+        {
+            return type_list_get_type_id<
+                    type_list<T, mixed_niche_none>,
+                    mixed_niche_none
+            >::value();
+        }
+
+        static constexpr type_list_tag_t value_tag()
+        {
+            return type_list_get_type_id<type_list<T, mixed_niche_none>, T>::value();
+        }
+    };
+
+    /// @brief Storage of trivially copyable variants: values are kept in the union (see
+    /// mixed_literal_union), so exl::mixed can be constructed and queried in constant expressions
+    /// in C++14 and later. Layout is the same as for the raw storage (see
+    /// mixed_is_literal_storage)
+    template <typename ... Types>
+    struct mixed_tagged_storage<type_list<Types...>, false, true>
+    {
+    public:
+        using storage_t = mixed_literal_union<Types...>;
+        using storage_operations_t = mixed_storage_operations<type_list<Types...>, storage_t>;
+
+    public:
+        constexpr mixed_tagged_storage() noexcept
+                : storage_()
+                , tag_(0) {}
+
+        template <typename T, typename ... Args>
+        constexpr mixed_tagged_storage(
+                in_place_type_t<T> type,
+                type_list_tag_t tag,
+                Args&& ... args
+        ) noexcept(std::is_nothrow_constructible<T, Args&&...>::value)
+                : storage_(type, std::forward<Args>(args)...)
+                , tag_(type_list_compact_tag_t<type_list<Types...>>(tag)) {}
+
+        constexpr type_list_tag_t tag() const noexcept
+        {
+            return tag_;
+        }
+
+        void set_tag(type_list_tag_t tag) noexcept
+        {
+            tag_ = type_list_compact_tag_t<type_list<Types...>>(tag);
+        }
+
+        void destroy_value() noexcept {}
+
+    public:
+        storage_t storage_;
+        type_list_compact_tag_t<type_list<Types...>> tag_;
+    };
+
+    /// @brief Describes placement of the tag in mixed storage
+    template <typename TL, bool = mixed_is_niche_optimizable<TL>::value()>
+    struct mixed_tag_layout
+    {
+        static constexpr size_t offset() { return offsetof(mixed_tagged_storage<TL>, tag_); }
+        static constexpr size_t size() { return sizeof(type_list_compact_tag_t<TL>); }
+    };
+
+    template <typename TL>
+    struct mixed_tag_layout<TL, true>
+    {
+        // Tag is encoded in the value itself
+        static constexpr size_t offset() { return offsetof(mixed_tagged_storage<TL>, storage_); }
+        static constexpr size_t size() { return 0; }
+    };
+
+    /// @brief Holds raw storage and tag of exl::mixed, provides construction and assignment
+    ///
+    /// All potentially throwing constructions of the stored value are performed in the
+    /// constructors of this type. This guarantees that destructor of the derived type will never
+    /// be called for partially-constructed object.
+    ///
+    /// @tparam TL Type list of the storage variants
+    template <typename TL>
+    struct mixed_storage : mixed_tagged_storage<TL>
+    {
+    public:
+        using type_list_t = TL;
+        using storage_t = typename mixed_tagged_storage<TL>::storage_t;
+        using storage_operations_t = typename mixed_tagged_storage<TL>::storage_operations_t;
+
+        using mixed_tagged_storage<TL>::storage_;
+        using mixed_tagged_storage<TL>::tag;
+        using mixed_tagged_storage<TL>::set_tag;
+        using mixed_tagged_storage<TL>::destroy_value;
+
+    public:
+        mixed_storage() = default;
+
+        /// @brief Constructs slot of type T in-place (see mixed_slot_traits)
+        template <typename T, typename ... Args>
+        constexpr mixed_storage(
+                in_place_type_t<T> type,
+                type_list_tag_t tag,
+                Args&& ... args
+        ) noexcept(std::is_nothrow_constructible<T, Args&&...>::value)
+                : mixed_tagged_storage<TL>(type, tag, std::forward<Args>(args)...) {}
+
+        /// @brief Constructs value by copy of the value stored in the subset storage. Tag is
+        /// stored as is when the subset is suffix of the type list (see type_list_is_suffix_of)
+        template <typename RhsTL>
+        mixed_storage(mixed_storage_copy_t, const mixed_storage<RhsTL>& rhs)
+        {
+            const auto rhsTag = rhs.tag();
+
+            copy_value_from(rhs, rhsTag, is_trivially_copyable_from<RhsTL>());
+            set_tag(mixed_storage_id_mapping<TL, RhsTL>::get(rhsTag));
+        }
+
+        /// @brief Constructs value by move of the value stored in the subset storage. Tag is
+        /// stored as is when the subset is suffix of the type list (see type_list_is_suffix_of)
+        template <typename RhsTL>
+        mixed_storage(mixed_storage_move_t, mixed_storage<RhsTL>&& rhs) noexcept
+        {
+            const auto rhsTag = rhs.tag();
+
+            move_value_from(std::move(rhs), rhsTag, is_trivially_copyable_from<RhsTL>());
+            set_tag(mixed_storage_id_mapping<TL, RhsTL>::get(rhsTag));
+        }
+
+        /// @brief Constructs value by move of the value stored in the storage with the same type
+        /// id and storage type (see mixed_storage_move_same_id_t), tag is stored as is
+        template <typename RhsTL>
+        mixed_storage(mixed_storage_move_same_id_t, mixed_storage<RhsTL>&& rhs) noexcept
+        {
+            const auto rhsTag = rhs.tag();
+
+            move_value_from(std::move(rhs), rhsTag, is_trivially_copyable_from<RhsTL>());
+            set_tag(rhsTag);
+        }
+
+        /// @brief Assigns copy of the value stored in the subset storage
+        template <typename RhsTL>
+        void assign_by_copy(const mixed_storage<RhsTL>& rhs)
+        {
+            using RhsStorage = typename mixed_storage<RhsTL>::storage_t;
+            using RhsStorageOperations = typename mixed_storage<RhsTL>::storage_operations_t;
+
+            const auto rhsTag = rhs.tag();
+            const auto mappedTag = mixed_storage_id_mapping<TL, RhsTL>::get(rhsTag);
+
+            if (tag() != mappedTag)
+            {
+                destroy_value();
+                RhsStorageOperations::copy_construct_from(
+                        reinterpret_cast<RhsStorage&>(storage_),
+                        rhs.storage_,
+                        rhsTag
+                );
+                set_tag(mappedTag);
+            }
+            else
+            {
+                RhsStorageOperations::copy_assign_from(
+                        reinterpret_cast<RhsStorage&>(storage_),
+                        rhs.storage_,
+                        rhsTag
+                );
+            }
+        }
+
+        /// @brief Assigns value moved from the subset storage
+        template <typename RhsTL>
+        void assign_by_move(mixed_storage<RhsTL>&& rhs) noexcept
+        {
+            using RhsStorage = typename mixed_storage<RhsTL>::storage_t;
+            using RhsStorageOperations = typename mixed_storage<RhsTL>::storage_operations_t;
+
+            const auto rhsTag = rhs.tag();
+            const auto mappedTag = mixed_storage_id_mapping<TL, RhsTL>::get(rhsTag);
+
+            if (tag() != mappedTag)
+            {
+                destroy_value();
+                RhsStorageOperations::move_construct_from(
+                        reinterpret_cast<RhsStorage&>(storage_),
+                        std::move(rhs.storage_),
+                        rhsTag
+                );
+                set_tag(mappedTag);
+            }
+            else
+            {
+                RhsStorageOperations::move_assign_from(
+                        reinterpret_cast<RhsStorage&>(storage_),
+                        std::move(rhs.storage_),
+                        rhsTag
+                );
+            }
+        }
+
+    private:
+        template <typename RhsTL>
+        using is_trivially_copyable_from = std::integral_constant<
+                bool,
+                type_list_all_of<RhsTL, std::is_trivially_copyable>::value()
+        >;
+
+        // Trivially copyable values are placed at the start of the storage in both storages, so
+        // the storage is copied without dispatch by tag. Stored value fits into both storages.
+        // Storage is passed to memcpy as void*, because literal union storage is not trivial
+        template <typename RhsTL>
+        static constexpr size_t common_storage_size()
+        {
+            return sizeof(typename mixed_storage<RhsTL>::storage_t) < sizeof(storage_t)
+                    ? sizeof(typename mixed_storage<RhsTL>::storage_t)
+                    : sizeof(storage_t);
+        }
+
+        template <typename RhsTL>
+        void copy_value_from(
+                const mixed_storage<RhsTL>& rhs,
+                type_list_tag_t,
+                std::true_type
+        ) noexcept
+        {
+            std::memcpy(
+                    static_cast<void*>(&storage_),
+                    static_cast<const void*>(&rhs.storage_),
+                    common_storage_size<RhsTL>()
+            );
+        }
+
+        template <typename RhsTL>
+        void copy_value_from(
+                const mixed_storage<RhsTL>& rhs,
+                type_list_tag_t rhsTag,
+                std::false_type
+        )
+        {
+            using RhsStorage = typename mixed_storage<RhsTL>::storage_t;
+
+            mixed_storage<RhsTL>::storage_operations_t::copy_construct_from(
+                    reinterpret_cast<RhsStorage&>(storage_),
+                    rhs.storage_,
+                    rhsTag
+            );
+        }
+
+        template <typename RhsTL>
+        void move_value_from(
+                mixed_storage<RhsTL>&& rhs,
+                type_list_tag_t,
+                std::true_type
+        ) noexcept
+        {
+            std::memcpy(
+                    static_cast<void*>(&storage_),
+                    static_cast<const void*>(&rhs.storage_),
+                    common_storage_size<RhsTL>()
+            );
+        }
+
+        template <typename RhsTL>
+        void move_value_from(
+                mixed_storage<RhsTL>&& rhs,
+                type_list_tag_t rhsTag,
+                std::false_type
+        ) noexcept
+        {
+            using RhsStorage = typename mixed_storage<RhsTL>::storage_t;
+
+            mixed_storage<RhsTL>::storage_operations_t::move_construct_from(
+                    reinterpret_cast<RhsStorage&>(storage_),
+                    std::move(rhs.storage_),
+                    rhsTag
+            );
+        }
+    };
+
+    /// @brief Extends mixed storage with destructor which destroys the stored value. Destructor
+    /// is trivial when all types of the type list are trivially destructible
+    ///
+    /// @tparam TL Type list of the storage variants
+    template <
+            typename TL,
+            bool = type_list_all_of<TL, std::is_trivially_destructible>::value()
+    >
+    struct mixed_destructor_base : mixed_storage<TL>
+    {
+    public:
+        using mixed_storage<TL>::mixed_storage;
+    };
+
+    template <typename TL>
+    struct mixed_destructor_base<TL, false> : mixed_storage<TL>
+    {
+    public:
+        using mixed_storage<TL>::mixed_storage;
+
+        mixed_destructor_base() = default;
+        mixed_destructor_base(const mixed_destructor_base&) = default;
+        mixed_destructor_base(mixed_destructor_base&&) = default;
+        mixed_destructor_base& operator=(const mixed_destructor_base&) = default;
+        mixed_destructor_base& operator=(mixed_destructor_base&&) = default;
+
+        ~mixed_destructor_base()
+        {
+            this->destroy_value();
+        }
+    };
+
+    /// @brief Extends mixed storage with copy constructor. Copy constructor is trivial when all
+    /// types of the type list are trivially copy constructible
+    ///
+    /// @tparam TL Type list of the storage variants
+    template <
+            typename TL,
+            bool = type_list_all_of<TL, std::is_trivially_copy_constructible>::value()
+    >
+    struct mixed_copy_constructor_base : mixed_destructor_base<TL>
+    {
+    public:
+        using mixed_destructor_base<TL>::mixed_destructor_base;
+    };
+
+    template <typename TL>
+    struct mixed_copy_constructor_base<TL, false> : mixed_destructor_base<TL>
+    {
+    public:
+        using mixed_destructor_base<TL>::mixed_destructor_base;
+
+        mixed_copy_constructor_base() = default;
+
+        mixed_copy_constructor_base(const mixed_copy_constructor_base& rhs)
+                : mixed_destructor_base<TL>(mixed_storage_copy_t(), rhs) {}
+
+        mixed_copy_constructor_base(mixed_copy_constructor_base&&) = default;
+        mixed_copy_constructor_base& operator=(const mixed_copy_constructor_base&) = default;
+        mixed_copy_constructor_base& operator=(mixed_copy_constructor_base&&) = default;
+    };
+
+    /// @brief Extends mixed storage with move constructor. Move constructor is trivial when all
+    /// types of the type list are trivially move constructible
+    ///
+    /// @tparam TL Type list of the storage variants
+    template <
+            typename TL,
+            bool = type_list_all_of<TL, std::is_trivially_move_constructible>::value()
+    >
+    struct mixed_move_constructor_base : mixed_copy_constructor_base<TL>
+    {
+    public:
+        using mixed_copy_constructor_base<TL>::mixed_copy_constructor_base;
+    };
+
+    template <typename TL>
+    struct mixed_move_constructor_base<TL, false> : mixed_copy_constructor_base<TL>
+    {
+    public:
+        using mixed_copy_constructor_base<TL>::mixed_copy_constructor_base;
+
+        mixed_move_constructor_base() = default;
+        mixed_move_constructor_base(const mixed_move_constructor_base&) = default;
+
+        mixed_move_constructor_base(mixed_move_constructor_base&& rhs) noexcept
+                : mixed_copy_constructor_base<TL>(mixed_storage_move_t(), std::move(rhs)) {}
+
+        mixed_move_constructor_base& operator=(const mixed_move_constructor_base&) = default;
+        mixed_move_constructor_base& operator=(mixed_move_constructor_base&&) = default;
+    };
+
+    /// @brief Checks if type can be copy-assigned by copy of its object representation
+    template <typename T>
+    struct mixed_is_trivially_copy_assignable
+    {
+        static constexpr bool value =
+                std::is_trivially_copy_constructible<T>::value &&
+                        std::is_trivially_copy_assignable<T>::value &&
+                        std::is_trivially_destructible<T>::value;
+    };
+
+    /// @brief Checks if type can be move-assigned by copy of its object representation
+    template <typename T>
+    struct mixed_is_trivially_move_assignable
+    {
+        static constexpr bool value =
+                std::is_trivially_move_constructible<T>::value &&
+                        std::is_trivially_move_assignable<T>::value &&
+                        std::is_trivially_destructible<T>::value;
+    };
+
+    /// @brief Extends mixed storage with copy assignment operator. Copy assignment is trivial
+    /// when all types of the type list are trivially copy constructible, copy assignable and
+    /// destructible
+    ///
+    /// @tparam TL Type list of the storage variants
+    template <
+            typename TL,
+            bool = type_list_all_of<TL, mixed_is_trivially_copy_assignable>::value()
+    >
+    struct mixed_copy_assign_base : mixed_move_constructor_base<TL>
+    {
+    public:
+        using mixed_move_constructor_base<TL>::mixed_move_constructor_base;
+    };
+
+    template <typename TL>
+    struct mixed_copy_assign_base<TL, false> : mixed_move_constructor_base<TL>
+    {
+    public:
+        using mixed_move_constructor_base<TL>::mixed_move_constructor_base;
+
+        mixed_copy_assign_base() = default;
+        mixed_copy_assign_base(const mixed_copy_assign_base&) = default;
+        mixed_copy_assign_base(mixed_copy_assign_base&&) = default;
+
+        mixed_copy_assign_base& operator=(const mixed_copy_assign_base& rhs)
+        {
+            this->assign_by_copy(rhs);
+            return *this;
+        }
+
+        mixed_copy_assign_base& operator=(mixed_copy_assign_base&&) = default;
+    };
+
+    /// @brief Extends mixed storage with move assignment operator. Move assignment is trivial
+    /// when all types of the type list are trivially move constructible, move assignable and
+    /// destructible
+    ///
+    /// @tparam TL Type list of the storage variants
+    template <
+            typename TL,
+            bool = type_list_all_of<TL, mixed_is_trivially_move_assignable>::value()
+    >
+    struct mixed_move_assign_base : mixed_copy_assign_base<TL>
+    {
+    public:
+        using mixed_copy_assign_base<TL>::mixed_copy_assign_base;
+    };
+
+    template <typename TL>
+    struct mixed_move_assign_base<TL, false> : mixed_copy_assign_base<TL>
+    {
+    public:
+        using mixed_copy_assign_base<TL>::mixed_copy_assign_base;
+
+        mixed_move_assign_base() = default;
+        mixed_move_assign_base(const mixed_move_assign_base&) = default;
+        mixed_move_assign_base(mixed_move_assign_base&&) = default;
+        mixed_move_assign_base& operator=(const mixed_move_assign_base&) = default;
+
+        mixed_move_assign_base& operator=(mixed_move_assign_base&& rhs) noexcept
+        {
+            this->assign_by_move(std::move(rhs));
+            return *this;
+        }
+    };
+
+    /// @brief Storage base of exl::mixed. Each special member function is trivial when it is
+    /// trivial for all types of the type list
+    template <typename TL>
+    using mixed_base = mixed_move_assign_base<TL>;
+}}
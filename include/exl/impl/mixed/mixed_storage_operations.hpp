@@ -7,9 +7,18 @@
 
 #include <exl/impl/mixed/type_list.hpp>
 #include <new>
+#include <type_traits>
+#include <utility>
 
 namespace exl { namespace impl
 {
+    /// @brief Performs type-erased operations on the mixed storage using chain of tag comparisons
+    ///
+    /// Compiler is able to inline the whole chain, which makes it the fastest option for the small
+    /// type lists
+    ///
+    /// @tparam TL Type list of the storage variants
+    /// @tparam Storage Raw storage type
     template <
             typename TL,
             typename Storage,
@@ -18,7 +27,7 @@ namespace exl { namespace impl
                     typename TL::head
             >::value()
     >
-    struct mixed_storage_operations
+    struct mixed_storage_operations_chain
     {
     public:
         using type_list_t = TL;
@@ -33,10 +42,7 @@ namespace exl { namespace impl
                 return;
             }
 
-            mixed_storage_operations<TL, Storage, ExpectedTag - 1>::destroy(
-                    storage,
-                    actualTag
-            );
+            Next::destroy(storage, actualTag);
         }
 
         static void copy_construct_from(
@@ -51,7 +57,7 @@ namespace exl { namespace impl
                 return;
             }
 
-            mixed_storage_operations<type_list_t, storage_t, ExpectedTag - 1>::copy_construct_from(
+            Next::copy_construct_from(
                     dest,
                     src,
                     srcTag
@@ -70,7 +76,7 @@ namespace exl { namespace impl
                 return;
             }
 
-            mixed_storage_operations<type_list_t, storage_t, ExpectedTag - 1>::move_construct_from(
+            Next::move_construct_from(
                     dest,
                     std::forward<Storage>(src),
                     srcTag
@@ -89,7 +95,7 @@ namespace exl { namespace impl
                 return;
             }
 
-            mixed_storage_operations<type_list_t, storage_t, ExpectedTag - 1>::copy_assign_from(
+            Next::copy_assign_from(
                     dest,
                     src,
                     srcTag
@@ -109,20 +115,33 @@ namespace exl { namespace impl
                 return;
             }
 
-            mixed_storage_operations<type_list_t, storage_t, ExpectedTag - 1>::move_assign_from(
+            Next::move_assign_from(
                     dest,
                     std::move(src),
                     srcTag
             );
         }
 
+        static void swap(Storage& lhs, Storage& rhs, type_list_tag_t tag) noexcept
+        {
+            if (tag == ExpectedTag)
+            {
+                using std::swap;
+                swap(reinterpret_cast<CurrentType&>(lhs), reinterpret_cast<CurrentType&>(rhs));
+                return;
+            }
+
+            Next::swap(lhs, rhs, tag);
+        }
+
     private:
         using CurrentType = typename impl::type_list_get_type_for_id<TL, ExpectedTag>::type;
+        using Next = mixed_storage_operations_chain<TL, Storage, ExpectedTag - 1>;
     };
 
 
     template <typename TL, typename Storage>
-    struct mixed_storage_operations<TL, Storage, 0>
+    struct mixed_storage_operations_chain<TL, Storage, 0>
     {
     public:
         static void destroy(Storage& storage, type_list_tag_t) noexcept
@@ -167,7 +186,153 @@ namespace exl { namespace impl
                     std::move(reinterpret_cast<CurrentType&>(src));
         }
 
+        static void swap(Storage& lhs, Storage& rhs, type_list_tag_t) noexcept
+        {
+            using std::swap;
+            swap(reinterpret_cast<CurrentType&>(lhs), reinterpret_cast<CurrentType&>(rhs));
+        }
+
     private:
         using CurrentType = typename impl::type_list_get_type_for_id<TL, 0>::type;
     };
+
+    /// @brief Performs type-erased operations on the mixed storage using table of functions
+    ///
+    /// Each operation is dispatched through the compile-time built table of function pointers,
+    /// so the cost of the operation does not depend on the type list size (single indirect call)
+    ///
+    /// @tparam TL Type list of the storage variants
+    /// @tparam Storage Raw storage type
+    template <typename TL, typename Storage>
+    struct mixed_storage_operations_table;
+
+    template <typename ... Types, typename Storage>
+    struct mixed_storage_operations_table<type_list<Types...>, Storage>
+    {
+    public:
+        using type_list_t = type_list<Types...>;
+        using storage_t = Storage;
+
+    public:
+        static void destroy(Storage& storage, type_list_tag_t actualTag) noexcept
+        {
+            using Func = void (*)(Storage&);
+            static constexpr Func table[] = { &destroy_as<Types>... };
+
+            table[index_of(actualTag)](storage);
+        }
+
+        static void copy_construct_from(
+                Storage& dest,
+                const Storage& src,
+                type_list_tag_t srcTag
+        )
+        {
+            using Func = void (*)(Storage&, const Storage&);
+            static constexpr Func table[] = { &copy_construct_as<Types>... };
+
+            table[index_of(srcTag)](dest, src);
+        }
+
+        static void move_construct_from(
+                Storage& dest,
+                Storage&& src,
+                type_list_tag_t srcTag
+        ) noexcept
+        {
+            using Func = void (*)(Storage&, Storage&);
+            static constexpr Func table[] = { &move_construct_as<Types>... };
+
+            table[index_of(srcTag)](dest, src);
+        }
+
+        static void copy_assign_from(
+                Storage& dest,
+                const Storage& src,
+                type_list_tag_t srcTag
+        )
+        {
+            using Func = void (*)(Storage&, const Storage&);
+            static constexpr Func table[] = { &copy_assign_as<Types>... };
+
+            table[index_of(srcTag)](dest, src);
+        }
+
+        static void move_assign_from(
+                Storage& dest,
+                Storage&& src,
+                type_list_tag_t srcTag
+        ) noexcept
+        {
+            using Func = void (*)(Storage&, Storage&);
+            static constexpr Func table[] = { &move_assign_as<Types>... };
+
+            table[index_of(srcTag)](dest, src);
+        }
+
+        static void swap(Storage& lhs, Storage& rhs, type_list_tag_t tag) noexcept
+        {
+            using Func = void (*)(Storage&, Storage&);
+            static constexpr Func table[] = { &swap_as<Types>... };
+
+            table[index_of(tag)](lhs, rhs);
+        }
+
+    private:
+        // Tables are filled in the type list order
+        static constexpr size_t index_of(type_list_tag_t tag) noexcept
+        {
+            return type_list_index_of_tag(sizeof...(Types), tag);
+        }
+
+        template <typename T>
+        static void destroy_as(Storage& storage) noexcept
+        {
+            reinterpret_cast<T*>(&storage)->~T();
+        }
+
+        template <typename T>
+        static void copy_construct_as(Storage& dest, const Storage& src)
+        {
+            new(&dest) (T)(reinterpret_cast<const T&>(src));
+        }
+
+        template <typename T>
+        static void move_construct_as(Storage& dest, Storage& src) noexcept
+        {
+            new(&dest) (T)(std::move(reinterpret_cast<T&>(src)));
+        }
+
+        template <typename T>
+        static void copy_assign_as(Storage& dest, const Storage& src)
+        {
+            reinterpret_cast<T&>(dest) = reinterpret_cast<const T&>(src);
+        }
+
+        template <typename T>
+        static void move_assign_as(Storage& dest, Storage& src) noexcept
+        {
+            reinterpret_cast<T&>(dest) = std::move(reinterpret_cast<T&>(src));
+        }
+
+        template <typename T>
+        static void swap_as(Storage& lhs, Storage& rhs) noexcept
+        {
+            using std::swap;
+            swap(reinterpret_cast<T&>(lhs), reinterpret_cast<T&>(rhs));
+        }
+    };
+
+    /// @brief Maximal type list size for which chain of comparisons is used instead of table
+    constexpr type_list_tag_t mixed_storage_operations_chain_max_size = 8;
+
+    /// @brief Selects most efficient storage operations implementation for the type list
+    /// @tparam TL Type list of the storage variants
+    /// @tparam Storage Raw storage type
+    template <typename TL, typename Storage>
+    using mixed_storage_operations = typename std::conditional<
+            (type_list_get_size<TL>::value() <= mixed_storage_operations_chain_max_size),
+            mixed_storage_operations_chain<TL, Storage>,
+            mixed_storage_operations_table<TL, Storage>
+    >::type;
 }}
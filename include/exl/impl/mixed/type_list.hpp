@@ -8,11 +8,27 @@
 #include <cstddef>
 #include <cstdint>
 #include <utility>
+#include <type_traits>
+
+#include <exl/impl/constexpr.hpp>
+#include <exl/impl/mixed/index_sequence.hpp>
 
 namespace exl { namespace impl
 {
-    /// @brief Represents id of type in the type list
-    using type_list_tag_t = uint8_t;
+    /// @brief Represents id of type in the type list. Stored tag of exl::mixed uses the smallest
+    /// type which is able to hold all ids of its type list (see type_list_compact_tag_t)
+    using type_list_tag_t = uint32_t;
+
+    /// @brief Returns position (in the type list order) of the type with the specified id in the
+    /// type list of the specified size. Type ids are assigned in the reverse order (head type has
+    /// the largest id), so the same conversion also returns id of the type at the position
+    constexpr size_t type_list_index_of_tag(size_t size, size_t tag) noexcept
+    {
+        return size - 1 - tag;
+    }
+
+    /// @brief Represents "not found" position in the type list
+    constexpr size_t type_list_npos = size_t(-1);
 
     /// @brief Represents nullptr-like substitution for template parameters
     struct type_list_null {};
@@ -44,15 +60,14 @@ namespace exl { namespace impl
     template <typename TL>
     struct type_list_get_size;
 
-    template <typename Head, typename ... Types>
-    struct type_list_get_size<type_list<Head, Types...>>
+    template <typename ... Types>
+    struct type_list_get_size<type_list<Types...>>
     {
     public:
         /// @brief Returns type list size
-        static constexpr type_list_tag_t value()
+        static constexpr size_t value()
         {
-            return type_list_get_size<typename type_list<Head, Types...>::tail>::value()
-                    + type_list_tag_t(1);
+            return sizeof...(Types);
         }
     };
 
@@ -60,9 +75,192 @@ namespace exl { namespace impl
     struct type_list_get_size<type_list_null>
     {
     public:
-        static constexpr type_list_tag_t value() { return 0; }
+        static constexpr size_t value() { return 0; }
+    };
+
+    /// @brief Selects the smallest unsigned type which is able to hold all type ids of the type
+    /// list with specified size
+    template <size_t Size>
+    using type_list_compact_tag_for_size = typename std::conditional<
+            (Size <= size_t(UINT8_MAX) + 1),
+            uint8_t,
+            typename std::conditional<(Size <= size_t(UINT16_MAX) + 1), uint16_t, uint32_t>::type
+    >::type;
+
+    /// @brief Type of the stored tag of exl::mixed with specified type list
+    template <typename TL>
+    using type_list_compact_tag_t = type_list_compact_tag_for_size<type_list_get_size<TL>::value()>;
+
+    /// @brief Compile-time array of values computed for each type of the type list (in the type
+    /// list order). Queries split the range in halves, so their evaluation depth is logarithmic
+    /// in the type list size, while the array itself is built with the single pack expansion
+    /// @tparam Size Type list size
+    template <size_t Size>
+    struct type_list_value_array
+    {
+    public:
+        /// @brief Returns position of the first non-zero value or type_list_npos
+        constexpr size_t find_first(size_t first = 0, size_t last = Size) const
+        {
+            return (last - first == 0)
+                    ? type_list_npos
+                    : (last - first == 1)
+                            ? (values[first] != 0 ? first : type_list_npos)
+                            : find_first_or_next(
+                                    find_first(first, middle(first, last)),
+                                    middle(first, last),
+                                    last
+                            );
+        }
+
+        /// @brief Returns count of the non-zero values
+        constexpr size_t count(size_t first = 0, size_t last = Size) const
+        {
+            return (last - first == 0)
+                    ? 0
+                    : (last - first == 1)
+                            ? (values[first] != 0 ? 1 : 0)
+                            : count(first, middle(first, last)) + count(middle(first, last), last);
+        }
+
+        /// @brief Returns position of the non-zero value with specified index (counting only
+        /// non-zero values). Index should be less than count()
+        constexpr size_t find_nth(size_t index, size_t first = 0, size_t last = Size) const
+        {
+            return (last - first == 1)
+                    ? first
+                    : find_nth_in_halves(
+                            index,
+                            count(first, middle(first, last)),
+                            first,
+                            last
+                    );
+        }
+
+        /// @brief Returns maximal value or zero for the empty type list
+        constexpr size_t max(size_t first = 0, size_t last = Size) const
+        {
+            return (last - first == 0)
+                    ? 0
+                    : (last - first == 1)
+                            ? values[first]
+                            : max_of(
+                                    max(first, middle(first, last)),
+                                    max(middle(first, last), last)
+                            );
+        }
+
+        /// @brief Returns 64-bit word of the type id bitmask: bit N of the word W is set when
+        /// value of the type with id (64 * W + N) is non-zero
+        constexpr uint64_t id_mask_word(size_t word, size_t first = 0, size_t last = Size) const
+        {
+            return (last - first == 0)
+                    ? uint64_t(0)
+                    : (last - first == 1)
+                            ? ((values[first] != 0 && id_of(first) / 64 == word)
+                                    ? (uint64_t(1) << (id_of(first) % 64))
+                                    : uint64_t(0))
+                            : id_mask_word(word, first, middle(first, last))
+                                    | id_mask_word(word, middle(first, last), last);
+        }
+
+    public:
+        // Additional trailing element keeps the array non-empty for the empty type lists
+        size_t values[Size + 1];
+
+    private:
+        static constexpr size_t middle(size_t first, size_t last)
+        {
+            return first + (last - first) / 2;
+        }
+
+        static constexpr size_t max_of(size_t lhs, size_t rhs)
+        {
+            return lhs > rhs ? lhs : rhs;
+        }
+
+        static constexpr size_t id_of(size_t position)
+        {
+            return type_list_index_of_tag(Size, position);
+        }
+
+        constexpr size_t find_first_or_next(size_t found, size_t first, size_t last) const
+        {
+            return found != type_list_npos ? found : find_first(first, last);
+        }
+
+        constexpr size_t find_nth_in_halves(
+                size_t index,
+                size_t firstHalfCount,
+                size_t first,
+                size_t last
+        ) const
+        {
+            return index < firstHalfCount
+                    ? find_nth(index, first, middle(first, last))
+                    : find_nth(index - firstHalfCount, middle(first, last), last);
+        }
+    };
+
+    /// @brief Helper type to obtain type at specified position (in the type list order). Types
+    /// are looked up with the single overload resolution instead of the recursive instantiation
+    template <typename TL, size_t Position>
+    struct type_list_get_type_at_position;
+
+    /// @brief Holds type of the type list with its position
+    template <size_t Position, typename T>
+    struct type_list_position_leaf
+    {
+        using type = T;
+    };
+
+    template <typename Sequence, typename ... Types>
+    struct type_list_position_lookup;
+
+    template <size_t ... Positions, typename ... Types>
+    struct type_list_position_lookup<index_sequence<Positions...>, Types...>
+            : type_list_position_leaf<Positions, Types>...
+    {
+    };
+
+    template <size_t Position, typename T>
+    type_list_position_leaf<Position, T> type_list_position_lookup_get(
+            const type_list_position_leaf<Position, T>*
+    );
+
+    template <size_t Position, typename ... Types>
+    struct type_list_get_type_at_position<type_list<Types...>, Position>
+    {
+    private:
+        using lookup_t = type_list_position_lookup<
+                make_index_sequence<sizeof...(Types)>,
+                Types...
+        >;
+
+    public:
+        using type = typename decltype(type_list_position_lookup_get<Position>(
+                static_cast<const lookup_t*>(nullptr)
+        ))::type;
     };
 
+    /// @brief Returns type with the specified position (in the type list order) of the type list
+    template <typename TL, size_t Position>
+    using type_list_get_type_at = typename type_list_get_type_at_position<TL, Position>::type;
+
+    /// @brief Builds type list from the types of TL, for which values of the Filter::value()
+    /// array are non-zero
+    template <
+            typename TL,
+            typename Filter,
+            typename Sequence = make_index_sequence<Filter::value().count()>
+    >
+    struct type_list_filter;
+
+    template <typename TL, typename Filter, size_t ... Indices>
+    struct type_list_filter<TL, Filter, index_sequence<Indices...>>
+    {
+        using type = type_list<type_list_get_type_at<TL, Filter::value().find_nth(Indices)>...>;
+    };
 
     /// @brief Helper type to obtain unique ID for specified Type in type list
     /// @tparam TL Type list to perform check on
@@ -71,31 +269,21 @@ namespace exl { namespace impl
     struct type_list_get_type_id;
 
     template <typename T, typename ... Types>
-    struct type_list_get_type_id<type_list<T, Types...>, T>
+    struct type_list_get_type_id<type_list<Types...>, T>
     {
     public:
         /// @brief Returns id of Specified type
         static constexpr type_list_tag_t value()
         {
-            return type_list_get_size<type_list<T, Types...>>::value() - type_list_tag_t(1);
+            return type_list_tag_t(type_list_index_of_tag(sizeof...(Types), position));
         }
-    };
 
-    template <typename T, typename Head, typename ... Types>
-    struct type_list_get_type_id<type_list<Head, Types...>, T>
-    {
-    public:
-        static constexpr type_list_tag_t value()
-        {
-            return type_list_get_type_id<type_list<Types...>, T>::value();
-        }
-    };
+    private:
+        static constexpr size_t position = type_list_value_array<sizeof...(Types)>{{
+                size_t(std::is_same<T, Types>::value)...
+        }}.find_first();
 
-    template <typename T>
-    struct type_list_get_type_id<type_list<T>, T>
-    {
-    public:
-        static constexpr type_list_tag_t value() { return 0; }
+        static_assert(position != type_list_npos, "Type is not present in the type list");
     };
 
     /// @brief Represents set of type id's for type_list
@@ -184,98 +372,141 @@ namespace exl { namespace impl
         using type = Lhs;
     };
 
+    /// @brief Builds set of type ids of the types of TL, for which values of the Filter::value()
+    /// array are non-zero. Ids are placed in the type list order
+    template <
+            typename TL,
+            typename Filter,
+            typename Sequence = make_index_sequence<Filter::value().count()>
+    >
+    struct type_list_filter_ids;
+
+    template <typename TL, typename Filter, size_t ... Indices>
+    struct type_list_filter_ids<TL, Filter, index_sequence<Indices...>>
+    {
+        using type = type_list_id_set<type_list_tag_t(type_list_index_of_tag(
+                type_list_get_size<TL>::value(),
+                Filter::value().find_nth(Indices)
+        ))...>;
+    };
+
     /// @brief Returns set of type ID's for derived types
     template <typename TL, typename T>
     struct type_list_get_ids_of_derived_types;
 
-    template <typename T, typename Head, typename ... Tail>
-    struct type_list_get_ids_of_derived_types<type_list<Head, Tail...>, T>
-    {
-        using type = typename std::conditional<
-                std::is_base_of<T, Head>::value,
-                // push new type to the list if type is same of derived
-                typename type_list_id_set_push_front<
-                        typename type_list_get_ids_of_derived_types<
-                                type_list<Tail...>, T
-                        >::type,
-                        type_list_get_type_id<type_list<Head, Tail...>, Head>::value()
-                >::type,
-                // skip current type otherwise
-                typename type_list_get_ids_of_derived_types<type_list<Tail...>, T>::type
-        >::type;
-    };
-
-    template <typename T, typename Head>
-    struct type_list_get_ids_of_derived_types<type_list<Head>, T>
+    template <typename T, typename ... Types>
+    struct type_list_get_ids_of_derived_types<type_list<Types...>, T>
     {
-        using type = typename std::conditional<
-                std::is_base_of<T, Head>::value,
-                // add last type if same of derived
-                type_list_id_set<type_list_get_type_id<type_list<Head>, Head>::value()>,
-                // return empty list otherwise
-                type_list_id_set<>
-        >::type;
+    private:
+        struct derived
+        {
+            static constexpr type_list_value_array<sizeof...(Types)> value()
+            {
+                return {{ size_t(std::is_base_of<T, Types>::value)... }};
+            }
+        };
+
+    public:
+        using type = typename type_list_filter_ids<type_list<Types...>, derived>::type;
     };
 
     /// @brief Returns set of type ID's for same types
     template <typename TL, typename T>
     struct type_list_get_ids_of_same_types;
 
-    template <typename T, typename Head, typename ... Tail>
-    struct type_list_get_ids_of_same_types<type_list<Head, Tail...>, T>
-    {
-        using type = typename std::conditional<
-                std::is_same<T, Head>::value,
-                // push new type to the list if type is same of derived
-                typename type_list_id_set_push_front<
-                        typename type_list_get_ids_of_same_types<
-                                type_list<Tail...>, T
-                        >::type,
-                        type_list_get_type_id<type_list<Head, Tail...>, Head>::value()
-                >::type,
-                // skip current type otherwise
-                typename type_list_get_ids_of_same_types<type_list<Tail...>, T>::type
-        >::type;
+    template <typename T, typename ... Types>
+    struct type_list_get_ids_of_same_types<type_list<Types...>, T>
+    {
+    private:
+        struct same
+        {
+            static constexpr type_list_value_array<sizeof...(Types)> value()
+            {
+                return {{ size_t(std::is_same<T, Types>::value)... }};
+            }
+        };
+
+    public:
+        using type = typename type_list_filter_ids<type_list<Types...>, same>::type;
     };
 
-    template <typename T, typename Head>
-    struct type_list_get_ids_of_same_types<type_list<Head>, T>
+    /// @brief Filter of the types, which are same as T or derived from it, see type_list_filter
+    template <typename TL, typename T>
+    struct type_list_derived_filter;
+
+    template <typename T, typename ... Types>
+    struct type_list_derived_filter<type_list<Types...>, T>
     {
-        using type = typename std::conditional<
-                std::is_same<T, Head>::value,
-                // add last type if same of derived
-                type_list_id_set<type_list_get_type_id<type_list<Head>, Head>::value()>,
-                // return empty list otherwise
-                type_list_id_set<>
-        >::type;
+        static constexpr type_list_value_array<sizeof...(Types)> value()
+        {
+            return {{
+                    size_t(std::is_same<T, Types>::value || std::is_base_of<T, Types>::value)...
+            }};
+        }
     };
 
-    /// @brief Helper type to calculate storage type size which suitable for any type in type list
-    /// @tparam TL Type list used for calculation of size
-    template <typename TL>
-    struct type_list_get_max_sizeof;
+    /// @brief Compile-time bitmask of the type ids, which types are same as T or derived from it.
+    /// Allows to check the type id with the single shift-and-test instead of the chain of
+    /// comparisons
+    /// @tparam TL Type list to build mask for
+    /// @tparam T Type to perform check for
+    template <typename TL, typename T>
+    struct type_list_derived_id_mask;
 
-    template <typename Head, typename ... Types>
-    struct type_list_get_max_sizeof<type_list<Head, Types...>>
+    template <typename T, typename ... Types>
+    struct type_list_derived_id_mask<type_list<Types...>, T>
     {
+    private:
+        using derived = type_list_derived_filter<type_list<Types...>, T>;
+
     public:
-        /// @brief Returns storage type size which suitable for any type in type list
-        static constexpr size_t value()
+        /// @brief Set of the type ids, which types are same as T or derived from it, in the type
+        /// list order
+        using ids_t = typename type_list_filter_ids<type_list<Types...>, derived>::type;
+
+    public:
+        /// @brief Returns true if type with specified id is same as T or derived from it
+        static EXL_CONSTEXPR14 bool contains(type_list_tag_t id) noexcept
         {
-            return (HEAD_SIZEOF > TAIL_MAX_SIZEOF) ? HEAD_SIZEOF : TAIL_MAX_SIZEOF;
+            return contains(id, std::integral_constant<bool, (sizeof...(Types) <= 64)>());
         }
 
     private:
-        static constexpr size_t HEAD_SIZEOF = sizeof(Head);
-        static constexpr size_t TAIL_MAX_SIZEOF =
-                type_list_get_max_sizeof<type_list<Types...>>::value();
+        static EXL_CONSTEXPR14 bool contains(type_list_tag_t id, std::true_type) noexcept
+        {
+            constexpr uint64_t mask = derived::value().id_mask_word(0);
+
+            return ((mask >> id) & 1u) != 0;
+        }
+
+        static bool contains(type_list_tag_t id, std::false_type) noexcept
+        {
+            return contains(id, make_index_sequence<(sizeof...(Types) + 63) / 64>());
+        }
+
+        template <size_t ... Words>
+        static bool contains(type_list_tag_t id, index_sequence<Words...>) noexcept
+        {
+            static constexpr uint64_t masks[] = { derived::value().id_mask_word(Words)... };
+
+            return ((masks[id / 64] >> (id % 64)) & 1u) != 0;
+        }
     };
 
-    template <>
-    struct type_list_get_max_sizeof<type_list<>>
+    /// @brief Helper type to calculate storage type size which suitable for any type in type list
+    /// @tparam TL Type list used for calculation of size
+    template <typename TL>
+    struct type_list_get_max_sizeof;
+
+    template <typename ... Types>
+    struct type_list_get_max_sizeof<type_list<Types...>>
     {
     public:
-        static constexpr size_t value() { return 0; }
+        /// @brief Returns storage type size which suitable for any type in type list
+        static constexpr size_t value()
+        {
+            return type_list_value_array<sizeof...(Types)>{{ sizeof(Types)... }}.max();
+        }
     };
 
     /// @brief Helper type to calculate storage type align which suitable for any type in type list
@@ -283,27 +514,50 @@ namespace exl { namespace impl
     template <typename TL>
     struct type_list_get_max_alignof;
 
-    template <typename Head, typename ... Types>
-    struct type_list_get_max_alignof<type_list<Head, Types...>>
+    template <typename ... Types>
+    struct type_list_get_max_alignof<type_list<Types...>>
     {
     public:
         /// @brief Returns storage type align which suitable for any type in type list
         static constexpr size_t value()
         {
-            return (HEAD_ALIGNOF > TAIL_MAX_ALIGNOF) ? HEAD_ALIGNOF : TAIL_MAX_ALIGNOF;
+            return type_list_value_array<sizeof...(Types)>{{ alignof(Types)... }}.max();
         }
+    };
 
-    private:
-        static constexpr size_t HEAD_ALIGNOF = alignof(Head);
-        static constexpr size_t TAIL_MAX_ALIGNOF =
-                type_list_get_max_alignof<type_list<Types...>>::value();
+    /// @brief Represents list of boolean values. Mostly used in internal methods
+    template <bool ...>
+    struct type_list_bool_sequence {};
+
+    /// @brief Helper type to check that all of the boolean values are true
+    template <bool ... Values>
+    struct type_list_bool_all_of
+    {
+    public:
+        static constexpr bool value()
+        {
+            return std::is_same<
+                    type_list_bool_sequence<true, Values...>,
+                    type_list_bool_sequence<Values..., true>
+            >::value;
+        }
     };
 
-    template <>
-    struct type_list_get_max_alignof<type_list<>>
+    /// @brief Helper type to check that predicate is satisfied for all types in the type list
+    /// @tparam TL Type list to perform check on
+    /// @tparam Predicate Type trait with boolean value member (e.g. std::is_trivially_destructible)
+    template <typename TL, template <typename> class Predicate>
+    struct type_list_all_of;
+
+    template <template <typename> class Predicate, typename ... Types>
+    struct type_list_all_of<type_list<Types...>, Predicate>
     {
     public:
-        static constexpr size_t value() { return 0; }
+        /// @brief Returns true if predicate is satisfied for all types of the type list
+        static constexpr bool value()
+        {
+            return type_list_bool_all_of<Predicate<Types>::value...>::value();
+        }
     };
 
     /// @brief Helper class to obtain Type in type list by its ID
@@ -313,24 +567,28 @@ namespace exl { namespace impl
     template <typename TL, type_list_tag_t id>
     struct type_list_get_type_for_id;
 
-
-    template <type_list_tag_t id, typename Head, typename ... Types>
-    struct type_list_get_type_for_id<type_list<Head, Types...>, id>
+    template <type_list_tag_t id, typename ... Types>
+    struct type_list_get_type_for_id<type_list<Types...>, id>
     {
-    public:
-        /// @brief Found type for specified ID
-        using type = typename std::conditional<
-                type_list_get_type_id<type_list<Head, Types...>, Head>::value() == id,
-                Head,
-                typename type_list_get_type_for_id<type_list<Types...>, id>::type
-        >::type;
-    };
+    private:
+        template <bool Found, typename = void>
+        struct lookup
+        {
+            using type = type_list_null;
+        };
+
+        template <typename Dummy>
+        struct lookup<true, Dummy>
+        {
+            using type = type_list_get_type_at<
+                    type_list<Types...>,
+                    type_list_index_of_tag(sizeof...(Types), id)
+            >;
+        };
 
-    template <type_list_tag_t id>
-    struct type_list_get_type_for_id<type_list<>, id>
-    {
     public:
-        using type = type_list_null;
+        /// @brief Found type for specified ID
+        using type = typename lookup<(id < sizeof...(Types))>::type;
     };
 
     /// @brief Helper type to check that type list contains specified type
@@ -339,28 +597,18 @@ namespace exl { namespace impl
     template <typename TL, typename T>
     struct type_list_has_type;
 
-    template <typename T, typename Head, typename ... Types>
-    struct type_list_has_type<type_list<Head, Types...>, T>
+    template <typename T, typename ... Types>
+    struct type_list_has_type<type_list<Types...>, T>
     {
         /// @brief Returns true if type list has specified type
         static constexpr bool value()
         {
-            return type_list_has_type<type_list<Types...>, T>::value();
+            return type_list_value_array<sizeof...(Types)>{{
+                    size_t(std::is_same<T, Types>::value)...
+            }}.find_first() != type_list_npos;
         }
     };
 
-    template <typename Head, typename ... Types>
-    struct type_list_has_type<type_list<Head, Types...>, Head>
-    {
-        static constexpr bool value() { return true; }
-    };
-
-    template <typename T>
-    struct type_list_has_type<type_list<>, T>
-    {
-        static constexpr bool value() { return false; }
-    };
-
     /// @brief Helper type to check if specified type list is subset of another type list
     /// @tparam TL Superset type list to perform check on
     /// @tparam SubsetTL Subset type list to perform check for
@@ -368,19 +616,58 @@ namespace exl { namespace impl
     template <typename Subset, typename Superset>
     struct type_list_is_subset_of;
 
-    template <typename TL, typename Head, typename ... Types>
-    struct type_list_is_subset_of<type_list<Head, Types...>, TL>
+    template <typename TL, typename ... Types>
+    struct type_list_is_subset_of<type_list<Types...>, TL>
     {
         /// @brief Returns true if specified type list is subset of specified superset
         static constexpr bool value()
         {
-            return type_list_has_type<TL, Head>::value()
-                    && type_list_is_subset_of<type_list<Types...>, TL>::value();
+            return type_list_bool_all_of<type_list_has_type<TL, Types>::value()...>::value();
         }
     };
 
-    template <typename TL>
-    struct type_list_is_subset_of<type_list<>, TL>
+    /// @brief Helper type to check if specified type list is suffix of another type list (e.g.
+    /// type_list<C, D> and type_list<A, B, C, D>). Type ids are assigned in the reverse order, so
+    /// types of the suffix have the same ids in both type lists
+    /// @tparam SubsetTL Subset type list to perform check for
+    /// @tparam TL Superset type list to perform check on
+    template <
+            typename SubsetTL,
+            typename TL,
+            typename = make_index_sequence<type_list_get_size<SubsetTL>::value()>,
+            bool = (type_list_get_size<SubsetTL>::value() <= type_list_get_size<TL>::value())
+    >
+    struct type_list_is_suffix_of
+    {
+        static constexpr bool value()
+        {
+            return false;
+        }
+    };
+
+    template <typename ... SubsetTypes, typename TL, size_t ... Indices>
+    struct type_list_is_suffix_of<type_list<SubsetTypes...>, TL, index_sequence<Indices...>, true>
+    {
+        /// @brief Returns true if specified type list is suffix of specified superset
+        static constexpr bool value()
+        {
+            return std::is_same<
+                    type_list<SubsetTypes...>,
+                    type_list<type_list_get_type_at<
+                            TL,
+                            type_list_get_size<TL>::value() - sizeof...(SubsetTypes) + Indices
+                    >...>
+            >::value;
+        }
+    };
+
+    template <typename ... Types, size_t ... Indices>
+    struct type_list_is_suffix_of<
+            type_list<Types...>,
+            type_list<Types...>,
+            index_sequence<Indices...>,
+            true
+    >
     {
         static constexpr bool value()
         {
@@ -388,7 +675,46 @@ namespace exl { namespace impl
         }
     };
 
+    /// @brief Packs superset type ids of the subset types into the single integer, where the
+    /// superset id of the subset type with id N is stored in the N-th byte
+    template <typename TL, typename ... SubsetTypes>
+    struct type_list_subset_id_packed_mapping;
+
+    template <typename TL>
+    struct type_list_subset_id_packed_mapping<TL>
+    {
+        static constexpr uint64_t value()
+        {
+            return 0;
+        }
+    };
+
+    template <typename TL, typename Head, typename ... Tail>
+    struct type_list_subset_id_packed_mapping<TL, Head, Tail...>
+    {
+        static constexpr uint64_t value()
+        {
+            // Subset id of the Head type is equal to the count of the following types
+            return (uint64_t(type_list_get_type_id<TL, Head>::value()) << (8 * sizeof...(Tail)))
+                    | type_list_subset_id_packed_mapping<TL, Tail...>::value();
+        }
+    };
+
+    /// @brief Maximal subset type list size for which mapping is packed into the single integer
+    constexpr size_t type_list_subset_id_packed_mapping_max_size = sizeof(uint64_t);
+
+    /// @brief Maximal superset type list size for which mapping is packed into the single integer
+    /// (each superset type id should fit into the single byte)
+    constexpr size_t type_list_subset_id_packed_mapping_max_superset_size = size_t(UINT8_MAX) + 1;
+
     /// @brief Helper type to get type id of subset's type list in superset type list
+    ///
+    /// Mapping is generated at compile time: mapping for the small subsets is packed into the
+    /// single integer constant (shift of the immediate value, no memory access), larger subsets
+    /// use single lookup in the table
+    ///
+    /// Mapping is identity when subset is suffix of the superset (see type_list_is_suffix_of)
+    ///
     /// @tparam TL Superset type list to perform mapping on
     /// @tparam SubsetTL Subset type list to perform mapping for
     /// @note WARNING: Mapping of type index, which is not bound to TL subset type will cause
@@ -396,39 +722,58 @@ namespace exl { namespace impl
     template <
             typename TL,
             typename SubsetTL,
-            type_list_tag_t ExpectedTag = type_list_get_type_id<
-                    SubsetTL,
-                    typename SubsetTL::head
-            >::value()
+            bool = type_list_is_suffix_of<SubsetTL, TL>::value()
     >
-    struct type_list_subset_id_mapping
-    {
-    public:
-        static constexpr type_list_tag_t mapped = type_list_get_type_id<
-                TL,
-                typename type_list_get_type_for_id<SubsetTL, ExpectedTag>::type
-        >::value();
+    struct type_list_subset_id_mapping;
 
+    template <typename TL, typename ... SubsetTypes>
+    struct type_list_subset_id_mapping<TL, type_list<SubsetTypes...>, false>
+    {
     public:
         /// @brief Returns ID which mapped to subset's type in superset type list
-        static type_list_tag_t get(type_list_tag_t targetID)
+        static type_list_tag_t get(type_list_tag_t targetID) noexcept
         {
-            return (targetID == ExpectedTag)
-                    ? mapped
-                    : type_list_subset_id_mapping<TL, SubsetTL, ExpectedTag - 1>::get(targetID);
+            return get(
+                    targetID,
+                    std::integral_constant<
+                            bool,
+                            (sizeof...(SubsetTypes) <= type_list_subset_id_packed_mapping_max_size)
+                                    && (type_list_get_size<TL>::value()
+                                            <= type_list_subset_id_packed_mapping_max_superset_size)
+                    >()
+            );
+        }
+
+    private:
+        static type_list_tag_t get(type_list_tag_t targetID, std::true_type) noexcept
+        {
+            constexpr uint64_t packed = type_list_subset_id_packed_mapping<
+                    TL,
+                    SubsetTypes...
+            >::value();
+
+            return type_list_tag_t(uint8_t(packed >> (8 * targetID)));
+        }
+
+        static type_list_tag_t get(type_list_tag_t targetID, std::false_type) noexcept
+        {
+            // Table is filled in the subset type list order
+            static constexpr type_list_compact_tag_t<TL> table[] = {
+                    type_list_compact_tag_t<TL>(type_list_get_type_id<TL, SubsetTypes>::value())...
+            };
+
+            return table[type_list_index_of_tag(sizeof...(SubsetTypes), targetID)];
         }
     };
 
     template <typename TL, typename SubsetTL>
-    struct type_list_subset_id_mapping<TL, SubsetTL, 0>
+    struct type_list_subset_id_mapping<TL, SubsetTL, true>
     {
     public:
-        static type_list_tag_t get(type_list_tag_t)
+        /// @brief Type ids of the suffix are equal to the superset type ids
+        static type_list_tag_t get(type_list_tag_t targetID) noexcept
         {
-            return type_list_get_type_id<
-                    TL,
-                    typename type_list_get_type_for_id<SubsetTL, 0>::type
-            >::value();
+            return targetID;
         }
     };
 
@@ -452,54 +797,40 @@ namespace exl { namespace impl
     template <typename TL, typename T>
     struct type_list_remove_same;
 
-    template <typename T, typename Head, typename ... Types>
-    struct type_list_remove_same<type_list<Head, Types...>, T>
+    template <typename T, typename ... Types>
+    struct type_list_remove_same<type_list<Types...>, T>
     {
-        using type = typename std::conditional<
-                std::is_same<Head, T>::value,
-                typename type_list_remove_same<type_list<Types...>, T>::type,
-                typename type_list_push_front<
-                        typename type_list_remove_same<type_list<Types...>, T>::type,
-                        Head
-                >::type
-        >::type;
-    };
+    private:
+        struct not_same
+        {
+            static constexpr type_list_value_array<sizeof...(Types)> value()
+            {
+                return {{ size_t(!std::is_same<Types, T>::value)... }};
+            }
+        };
 
-    template <typename T, typename Head>
-    struct type_list_remove_same<type_list<Head>, T>
-    {
-        using type = typename std::conditional<
-                std::is_same<Head, T>::value,
-                type_list<>,
-                type_list<Head>
-        >::type;
+    public:
+        using type = typename type_list_filter<type_list<Types...>, not_same>::type;
     };
 
-    // @brief removes all types from the type list which are the same type as specified
+    // @brief removes all types from the type list which are derived from the specified type
     template <typename TL, typename T>
     struct type_list_remove_derived;
 
-    template <typename T, typename Head, typename ... Types>
-    struct type_list_remove_derived<type_list<Head, Types...>, T>
+    template <typename T, typename ... Types>
+    struct type_list_remove_derived<type_list<Types...>, T>
     {
-        using type = typename std::conditional<
-                std::is_base_of<T, Head>::value,
-                typename type_list_remove_derived<type_list<Types...>, T>::type,
-                typename type_list_push_front<
-                        typename type_list_remove_derived<type_list<Types...>, T>::type,
-                        Head
-                >::type
-        >::type;
-    };
+    private:
+        struct not_derived
+        {
+            static constexpr type_list_value_array<sizeof...(Types)> value()
+            {
+                return {{ size_t(!std::is_base_of<T, Types>::value)... }};
+            }
+        };
 
-    template <typename T, typename Head>
-    struct type_list_remove_derived<type_list<Head>, T>
-    {
-        using type = typename std::conditional<
-                std::is_base_of<T, Head>::value,
-                type_list<>,
-                type_list<Head>
-        >::type;
+    public:
+        using type = typename type_list_filter<type_list<Types...>, not_derived>::type;
     };
 
     /// @brief Represents list of type IDs. Mostly used in internal methods
@@ -508,17 +839,18 @@ namespace exl { namespace impl
 
     /// @brief Produced a type_list_id_sequence instantiation for specified type list
     /// @tparam TL type list to produce sequence for
-    template <typename TL>
+    template <
+            typename TL,
+            typename Sequence = make_index_sequence<type_list_get_size<TL>::value()>
+    >
     struct type_list_id_sequence_for;
 
-    template <typename ... Types>
-    struct type_list_id_sequence_for<type_list<Types...>>
+    template <typename ... Types, size_t ... Positions>
+    struct type_list_id_sequence_for<type_list<Types...>, index_sequence<Positions...>>
     {
-    private:
-        using TL = type_list<Types...>;
-
-    public:
-        using type = type_list_id_sequence<type_list_get_type_id<TL, Types>::value()...>;
+        using type = type_list_id_sequence<
+                type_list_tag_t(type_list_index_of_tag(sizeof...(Types), Positions))...
+        >;
     };
 
     // NOTE: Design of best-match overload implementation was "greatly inspired" by code from
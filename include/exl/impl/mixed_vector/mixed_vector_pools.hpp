@@ -0,0 +1,193 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <exl/impl/mixed/index_sequence.hpp>
+#include <exl/impl/mixed/mixed_map_table.hpp>
+#include <exl/impl/mixed/type_list.hpp>
+
+namespace exl { namespace impl
+{
+    /// @brief Value type of the exl::mixed_vector pool of values of type T
+    template <typename T>
+    struct mixed_vector_pool_value
+    {
+        using type = T;
+
+        static T& get(T& value) noexcept { return value; }
+        static const T& get(const T& value) noexcept { return value; }
+    };
+
+    /// @brief bool values are wrapped, so their pool is not std::vector<bool>, which can't
+    /// return references to its elements
+    template <>
+    struct mixed_vector_pool_value<bool>
+    {
+        struct type
+        {
+            type() noexcept : value() {}
+
+            template <
+                    typename U,
+                    typename = typename std::enable_if<
+                            !std::is_same<typename std::decay<U>::type, type>::value
+                    >::type
+            >
+            type(U&& rhs) : value(std::forward<U>(rhs)) {}
+
+            bool value;
+        };
+
+        static bool& get(type& value) noexcept { return value.value; }
+        static const bool& get(const type& value) noexcept { return value.value; }
+    };
+
+    /// @brief Per-type payload pools of exl::mixed_vector: values of each type are stored
+    /// contiguously in the separate vector, in the insertion order. Operations on the value of the
+    /// type which is known only at runtime are dispatched by tag with the table of functions
+    ///
+    /// @tparam TL Type list of the exl::mixed_vector
+    template <typename TL>
+    class mixed_vector_pools;
+
+    template <typename ... Types>
+    class mixed_vector_pools<type_list<Types...>>
+    {
+    public:
+        using type_list_t = type_list<Types...>;
+        using index_t = uint32_t;
+
+        template <typename T>
+        using value_t = typename mixed_vector_pool_value<T>::type;
+
+    public:
+        /// @brief Returns pool of the values of type T. Elements of the pool are accessed with
+        /// mixed_vector_pools::get
+        template <typename T>
+        std::vector<value_t<T>>& pool() noexcept
+        {
+            return std::get<pool_index<T>()>(pools_);
+        }
+
+        /// @brief Returns const pool of the values of type T
+        template <typename T>
+        const std::vector<value_t<T>>& pool() const noexcept
+        {
+            return std::get<pool_index<T>()>(pools_);
+        }
+
+        /// @brief Returns reference to the value of type T stored in the pool element
+        template <typename T>
+        static T& get(value_t<T>& value) noexcept
+        {
+            return mixed_vector_pool_value<T>::get(value);
+        }
+
+        /// @brief Returns const reference to the value of type T stored in the pool element
+        template <typename T>
+        static const T& get(const value_t<T>& value) noexcept
+        {
+            return mixed_vector_pool_value<T>::get(value);
+        }
+
+        /// @brief Removes the last value of the pool selected by tag
+        void pop_back(type_list_tag_t tag) noexcept
+        {
+            using Func = void (*)(pools_t&);
+            static constexpr Func table[] = { &pop_back_as<Types>... };
+
+            table[index_of(tag)](pools_);
+        }
+
+        /// @brief Removes all values of all pools
+        void clear() noexcept
+        {
+            clear(make_index_sequence<sizeof...(Types)>());
+        }
+
+        /// @brief Invokes matcher selected for the value with specified tag and index in its pool.
+        /// see mixed_map_table
+        /// @tparam Qualified Reference to the pools (const mixed_vector_pools& or
+        /// mixed_vector_pools&), which defines constness of the values passed to the matchers
+        template <typename Qualified, typename U, typename ... Matchers>
+        static U map(
+                Qualified self,
+                type_list_tag_t tag,
+                index_t index,
+                std::tuple<typename std::decay<Matchers>::type...>& matchers
+        ) noexcept
+        {
+            using Func = U (*)(
+                    Qualified,
+                    index_t,
+                    std::tuple<typename std::decay<Matchers>::type...>&
+            );
+            static constexpr Func table[] = { &call_as<Qualified, U, Types, Matchers...>... };
+
+            return table[index_of(tag)](self, index, matchers);
+        }
+
+    private:
+        using pools_t = std::tuple<std::vector<value_t<Types>>...>;
+
+        // Pools are placed in the type list order
+        static constexpr size_t index_of(type_list_tag_t tag) noexcept
+        {
+            return type_list_index_of_tag(sizeof...(Types), tag);
+        }
+
+        template <typename T>
+        static constexpr size_t pool_index() noexcept
+        {
+            return index_of(type_list_get_type_id<type_list_t, T>::value());
+        }
+
+        template <typename T>
+        static void pop_back_as(pools_t& pools) noexcept
+        {
+            std::get<pool_index<T>()>(pools).pop_back();
+        }
+
+        template <size_t ... Indices>
+        void clear(index_sequence<Indices...>) noexcept
+        {
+            using expand = int[];
+            static_cast<void>(expand { 0, (std::get<Indices>(pools_).clear(), 0)... });
+        }
+
+        template <typename Qualified, typename U, typename T, typename ... Matchers>
+        static U call_as(
+                Qualified self,
+                index_t index,
+                std::tuple<typename std::decay<Matchers>::type...>& matchers
+        )
+        {
+            constexpr size_t matcherIndex = mixed_matcher_select<T, Matchers...>::value();
+            static_assert(
+                    matcherIndex < sizeof...(Matchers),
+                    "exl::mixed_vector::reference::map matchers should cover all types"
+            );
+
+            using Matcher = typename std::decay<
+                    typename std::tuple_element<matcherIndex, std::tuple<Matchers...>>::type
+            >::type;
+
+            return mixed_matcher_invoke<typename Matcher::kind_t>::template call<U>(
+                    std::get<matcherIndex>(matchers),
+                    get<T>(self.template pool<T>()[index])
+            );
+        }
+
+    private:
+        pools_t pools_;
+    };
+}}
@@ -0,0 +1,175 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define EXL_TAG_SCAN_SSE2 1
+    #include <emmintrin.h>
+#else
+    #define EXL_TAG_SCAN_SSE2 0
+#endif
+
+namespace exl { namespace impl
+{
+    /// @brief Counts and searches tags, which are equal to any of the target tags, in the dense
+    /// array of tags by checking them one by one
+    /// @tparam Tag Tag type
+    template <typename Tag>
+    struct tag_scan_scalar
+    {
+    public:
+        /// @brief Returns count of tags in [tags, tags + size), which are equal to any of the
+        /// targets
+        static size_t count(
+                const Tag* tags,
+                size_t size,
+                const Tag* targets,
+                size_t targetsCount
+        ) noexcept
+        {
+            size_t result = 0;
+            for (size_t i = 0; i < size; ++i)
+            {
+                result += size_t(matches(tags[i], targets, targetsCount));
+            }
+
+            return result;
+        }
+
+        /// @brief Returns index of the first tag in [tags, tags + size), which is equal to any of
+        /// the targets, or size when there is no such tag
+        static size_t find(
+                const Tag* tags,
+                size_t size,
+                const Tag* targets,
+                size_t targetsCount
+        ) noexcept
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                if (matches(tags[i], targets, targetsCount))
+                {
+                    return i;
+                }
+            }
+
+            return size;
+        }
+
+    private:
+        static bool matches(Tag tag, const Tag* targets, size_t targetsCount) noexcept
+        {
+            for (size_t i = 0; i < targetsCount; ++i)
+            {
+                if (tag == targets[i])
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+    };
+
+    /// @brief Counts and searches tags, which are equal to any of the target tags, in the dense
+    /// array of tags (see exl::mixed_vector). Vectorized for the single byte tags when the
+    /// target supports it
+    /// @tparam Tag Tag type
+    template <typename Tag>
+    struct tag_scan : tag_scan_scalar<Tag> {};
+
+#if EXL_TAG_SCAN_SSE2
+
+    /// @brief Scan of the single byte tags (type lists up to 256 types) with SSE2: tags are
+    /// compared with the targets by 16 at once, tail is checked one by one
+    template <>
+    struct tag_scan<uint8_t>
+    {
+    public:
+        static size_t count(
+                const uint8_t* tags,
+                size_t size,
+                const uint8_t* targets,
+                size_t targetsCount
+        ) noexcept
+        {
+            size_t result = 0;
+            size_t i = 0;
+
+            for (; i + BLOCK_SIZE <= size; i += BLOCK_SIZE)
+            {
+                result += popcount(match_mask(tags + i, targets, targetsCount));
+            }
+
+            return result + tag_scan_tail::count(tags + i, size - i, targets, targetsCount);
+        }
+
+        static size_t find(
+                const uint8_t* tags,
+                size_t size,
+                const uint8_t* targets,
+                size_t targetsCount
+        ) noexcept
+        {
+            size_t i = 0;
+
+            for (; i + BLOCK_SIZE <= size; i += BLOCK_SIZE)
+            {
+                auto mask = match_mask(tags + i, targets, targetsCount);
+                if (mask != 0)
+                {
+                    for (; (mask & 1u) == 0; mask >>= 1)
+                    {
+                        ++i;
+                    }
+
+                    return i;
+                }
+            }
+
+            return i + tag_scan_tail::find(tags + i, size - i, targets, targetsCount);
+        }
+
+    private:
+        using tag_scan_tail = tag_scan_scalar<uint8_t>;
+
+        static constexpr size_t BLOCK_SIZE = 16;
+
+        // Returns bit mask of the block tags, which are equal to any of the targets
+        static uint32_t match_mask(
+                const uint8_t* block,
+                const uint8_t* targets,
+                size_t targetsCount
+        ) noexcept
+        {
+            const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block));
+
+            __m128i matched = _mm_setzero_si128();
+            for (size_t i = 0; i < targetsCount; ++i)
+            {
+                matched = _mm_or_si128(
+                        matched,
+                        _mm_cmpeq_epi8(values, _mm_set1_epi8(static_cast<char>(targets[i])))
+                );
+            }
+
+            return static_cast<uint32_t>(_mm_movemask_epi8(matched));
+        }
+
+        static size_t popcount(uint32_t mask) noexcept
+        {
+            mask = mask - ((mask >> 1) & 0x55555555u);
+            mask = (mask & 0x33333333u) + ((mask >> 2) & 0x33333333u);
+            mask = (mask + (mask >> 4)) & 0x0F0F0F0Fu;
+            return static_cast<size_t>((mask * 0x01010101u) >> 24);
+        }
+    };
+
+#endif
+}}
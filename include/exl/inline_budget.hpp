@@ -0,0 +1,36 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <cstddef>
+
+namespace exl
+{
+    /// @brief Storage policy of exl::mixed: alternatives which are larger than Size bytes are
+    /// allocated in the heap, so the size of exl::mixed is bounded by the budget.
+    ///
+    /// Policy is specified as the first type of the exl::mixed type list and is not an
+    /// alternative itself. Heap-allocated alternatives are owned by exl::mixed (as by exl::box),
+    /// allocation is performed only when such alternative is constructed. Access to the
+    /// alternatives (exl::mixed::is, exl::mixed::unwrap, exl::mixed::map etc.) is the same as
+    /// for the inline ones
+    /// ```
+    /// // Bulk is stored in the heap, sizeof(Message) == 16
+    /// using Message = exl::mixed<exl::inline_budget<8>, Ping, Ack, Bulk>;
+    /// ```
+    ///
+    /// @note Failed allocation of the alternative calls std::terminate
+    ///
+    /// @tparam Size Maximal size of the alternative stored inline
+    template <size_t Size>
+    struct inline_budget
+    {
+        static constexpr size_t size()
+        {
+            return Size;
+        }
+    };
+}
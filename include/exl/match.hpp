@@ -0,0 +1,93 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <exl/matchers.hpp>
+#include <exl/mixed.hpp>
+
+#include <exl/impl/mixed/index_sequence.hpp>
+#include <exl/impl/mixed/mixed_multi_map_table.hpp>
+
+namespace exl
+{
+    namespace impl
+    {
+        template <typename U, size_t ... MixedIndices, size_t ... MatcherIndices, typename Args>
+        U mixed_multi_map(
+                index_sequence<MixedIndices...>,
+                index_sequence<MatcherIndices...>,
+                Args&& args
+        ) noexcept
+        {
+            using table_t = mixed_multi_map_table<
+                    U,
+                    type_list<mixed_base_type_t<typename std::decay<
+                            typename std::tuple_element<MixedIndices, Args>::type
+                    >::type>...>,
+                    type_list<typename std::tuple_element<
+                            sizeof...(MixedIndices) + MatcherIndices,
+                            Args
+                    >::type...>
+            >;
+
+            typename table_t::matchers_t matchers(
+                    std::get<sizeof...(MixedIndices) + MatcherIndices>(std::move(args))...
+            );
+
+            return table_t::dispatch(matchers, std::get<MixedIndices>(args)...);
+        }
+    }
+
+    /// @brief Visiting function for multiple exl::mixed values (e.g. state and event pair).
+    ///
+    /// Arguments are one or more exl::mixed values (or derived types like exl::option) followed
+    /// by the set of matchers: exl::when_all, exl::when_all_exact and exl::otherwise. Set of
+    /// matchers should cover all combinations of the value types, otherwise code will not compile.
+    /// Matchers are checked in order, first matcher which accepts all value types wins.
+    /// All functors of the matchers should return value of type U.
+    ///
+    /// Matcher for each combination of types is selected at compile time, so the match is
+    /// performed with the single indirect call through the table indexed by all values tags
+    /// ```
+    /// auto next = exl::map<State>(state, event,
+    ///     exl::when_all_exact<Idle, Start>([](const Idle&, const Start& e) { ... }),
+    ///     exl::when_all<Running, Error>([](const Running&, const Error& e) { ... }),
+    ///     exl::otherwise([]() { ... }));
+    /// ```
+    ///
+    /// @tparam U return type of map expression
+    /// @param args exl::mixed values followed by matcher objects
+    template <typename U, typename ... Args>
+    U map(Args&& ... args) noexcept
+    {
+        static_assert(
+                impl::mixed_leading_count<Args...>::value() > 0,
+                "exl::map should receive at least one exl::mixed value"
+        );
+
+        return impl::mixed_multi_map<U>(
+                impl::make_index_sequence<impl::mixed_leading_count<Args...>::value()>(),
+                impl::make_index_sequence<
+                        sizeof...(Args) - impl::mixed_leading_count<Args...>::value()
+                >(),
+                std::forward_as_tuple(std::forward<Args>(args)...)
+        );
+    }
+
+    /// @brief Visiting function for multiple exl::mixed values with void return type.
+    /// see exl::map
+    /// @param args exl::mixed values followed by matcher objects
+    template <typename ... Args>
+    void match(Args&& ... args) noexcept
+    {
+        return map<void>(std::forward<Args>(args)...);
+    }
+}
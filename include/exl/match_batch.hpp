@@ -0,0 +1,230 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include <exl/matchers.hpp>
+#include <exl/mixed.hpp>
+
+#include <exl/impl/mixed/mixed_batch_block.hpp>
+#include <exl/impl/mixed/mixed_map_table.hpp>
+#include <exl/impl/mixed/mixed_multi_map_table.hpp>
+#include <exl/impl/mixed/type_list.hpp>
+
+namespace exl
+{
+    namespace impl
+    {
+        /// @brief Returns exl::mixed base type of the values referenced by the iterator, with
+        /// constness of the referenced values
+        template <typename Iterator>
+        using mixed_batch_value_t = typename std::conditional<
+                std::is_const<typename std::remove_reference<
+                        decltype(*std::declval<Iterator&>())
+                >::type>::value,
+                const mixed_base_type_t<typename std::decay<
+                        decltype(*std::declval<Iterator&>())
+                >::type>,
+                mixed_base_type_t<typename std::decay<decltype(*std::declval<Iterator&>())>::type>
+        >::type;
+
+        /// @brief Invokes matchers over the buckets of the partitioned block of values (see
+        /// mixed_batch_block). Matcher for each bucket is selected at compile time, so each
+        /// bucket is processed with the loop of direct calls of the same matcher
+        template <typename U, typename Mixed, typename TL, typename ... Matchers>
+        struct mixed_batch_map;
+
+        template <typename U, typename Mixed, typename ... Slots, typename ... Matchers>
+        struct mixed_batch_map<U, Mixed, type_list<Slots...>, Matchers...>
+        {
+        public:
+            using block_t = mixed_batch_block<Mixed>;
+            using map_table_t = mixed_map_table<U, type_list<Slots...>, Matchers...>;
+            using matchers_t = typename map_table_t::matchers_t;
+
+        public:
+            /// @brief Invokes matchers for the values of the range block by block
+            template <typename Iterator>
+            static void match_range(Iterator first, Iterator last, matchers_t& matchers)
+            {
+                block_t block;
+                while (first != last)
+                {
+                    first = block.fill(first, last);
+                    match(block, matchers);
+                }
+            }
+
+            /// @brief Assigns results for the values of the range to the output range starting
+            /// at out, in the range order
+            /// @return Iterator past the last result
+            template <typename Iterator, typename OutputIterator>
+            static OutputIterator map_range(
+                    Iterator first,
+                    Iterator last,
+                    OutputIterator out,
+                    matchers_t& matchers
+            )
+            {
+                block_t block;
+                while (first != last)
+                {
+                    first = block.fill(first, last);
+                    out = map(block, out, matchers);
+                }
+
+                return out;
+            }
+
+        private:
+            using storage_t = typename std::remove_const<Mixed>::type::storage_t;
+            using qualified_t = typename std::conditional<
+                    std::is_const<Mixed>::value,
+                    const storage_t&,
+                    storage_t&
+            >::type;
+
+            static void match(const block_t& block, matchers_t& matchers)
+            {
+                using expand = int[];
+                static_cast<void>(expand { 0, (match_as<Slots>(block, matchers), 0)... });
+            }
+
+            /// @brief Assigns results for the block values to the output range starting at out
+            /// @return Iterator past the last result of the block
+            template <typename OutputIterator>
+            static OutputIterator map(
+                    const block_t& block,
+                    OutputIterator out,
+                    matchers_t& matchers
+            )
+            {
+                using expand = int[];
+                static_cast<void>(expand { 0, (map_as<Slots>(block, out, matchers), 0)... });
+
+                using difference_t = typename std::iterator_traits<OutputIterator>::difference_type;
+                return out + static_cast<difference_t>(block.size());
+            }
+
+            template <typename Slot>
+            static constexpr type_list_tag_t tag_of()
+            {
+                return type_list_get_type_id<type_list<Slots...>, Slot>::value();
+            }
+
+            template <typename Slot>
+            static void match_as(const block_t& block, matchers_t& matchers)
+            {
+                const auto end = block.bucket_end(tag_of<Slot>());
+                for (auto position = block.bucket_begin(tag_of<Slot>()); position != end;
+                     ++position)
+                {
+                    map_table_t::template call_as<qualified_t, Slot>(
+                            mixed_access::storage(block.value(*position)),
+                            matchers
+                    );
+                }
+            }
+
+            template <typename Slot, typename OutputIterator>
+            static void map_as(
+                    const block_t& block,
+                    OutputIterator out,
+                    matchers_t& matchers
+            )
+            {
+                using difference_t = typename std::iterator_traits<OutputIterator>::difference_type;
+
+                const auto end = block.bucket_end(tag_of<Slot>());
+                for (auto position = block.bucket_begin(tag_of<Slot>()); position != end;
+                     ++position)
+                {
+                    out[static_cast<difference_t>(*position)] =
+                            map_table_t::template call_as<qualified_t, Slot>(
+                                    mixed_access::storage(block.value(*position)),
+                                    matchers
+                            );
+                }
+            }
+        };
+
+        template <typename U, typename Iterator, typename ... Matchers>
+        using mixed_batch_map_t = mixed_batch_map<
+                U,
+                mixed_batch_value_t<Iterator>,
+                typename std::remove_const<mixed_batch_value_t<Iterator>>::type
+                        ::storage_type_list_t,
+                Matchers...
+        >;
+    }
+
+    /// @brief Batch visiting function for the range of exl::mixed values (or derived types like
+    /// exl::option), unordered mode.
+    ///
+    /// Range is processed by blocks of up to 256 values: values of the block are grouped by type
+    /// in one pass, then each group is processed by its matcher as a whole. Matcher for each type
+    /// is selected at compile time, so each group is handled by the tight loop of direct calls
+    /// without per-value dispatch, which keeps branches predictable and allows the compiler to
+    /// vectorize simple matchers. Matchers are the same as for exl::mixed::match and should cover
+    /// all types, otherwise code will not compile. No dynamic memory is allocated.
+    ///
+    /// Within the block values are visited in the order of type ids, values of the same type are
+    /// visited in the range order. Use exl::map_batch when results are required in the range
+    /// order.
+    /// ```
+    /// exl::match_batch(events.begin(), events.end(),
+    ///     exl::when<Click>([&](const Click& e) { clicks += e.count; }),
+    ///     exl::when<Scroll>([&](const Scroll& e) { scrolled += e.delta; }));
+    /// ```
+    ///
+    /// @param first, last forward iterators of the range
+    /// @param matchers matcher objects
+    template <typename Iterator, typename ... Matchers>
+    void match_batch(Iterator first, Iterator last, Matchers&& ... matchers) noexcept
+    {
+        using batch_map_t = impl::mixed_batch_map_t<void, Iterator, Matchers...>;
+
+        typename batch_map_t::matchers_t matchersTuple(std::forward<Matchers>(matchers)...);
+        batch_map_t::match_range(first, last, matchersTuple);
+    }
+
+    /// @brief Batch mapping function for the range of exl::mixed values, order-preserving mode.
+    ///
+    /// Values are grouped by type and processed by matchers group by group as in
+    /// exl::match_batch, while result for each value is assigned to the output position with
+    /// the same offset as the value in the source range, so results are in the range order.
+    /// All functors of the matchers should return value of type U.
+    /// ```
+    /// std::vector<size_t> sizes(messages.size());
+    /// exl::map_batch<size_t>(messages.begin(), messages.end(), sizes.begin(),
+    ///     exl::when<Text>([](const Text& m) { return m.body.size(); }),
+    ///     exl::otherwise([]() { return size_t(0); }));
+    /// ```
+    ///
+    /// @tparam U return type of map expression
+    /// @param first, last forward iterators of the range
+    /// @param out random access iterator to the output range of at least (last - first)
+    /// assignable values
+    /// @param matchers matcher objects
+    /// @return Iterator past the last written output value
+    template <typename U, typename Iterator, typename OutputIterator, typename ... Matchers>
+    OutputIterator map_batch(
+            Iterator first,
+            Iterator last,
+            OutputIterator out,
+            Matchers&& ... matchers
+    ) noexcept
+    {
+        using batch_map_t = impl::mixed_batch_map_t<U, Iterator, Matchers...>;
+
+        typename batch_map_t::matchers_t matchersTuple(std::forward<Matchers>(matchers)...);
+        return batch_map_t::map_range(first, last, out, matchersTuple);
+    }
+}
@@ -8,6 +8,8 @@
 #include <utility>
 #include <type_traits>
 
+#include <exl/impl/mixed/type_list.hpp>
+
 namespace exl
 {
     namespace impl
@@ -19,10 +21,18 @@ namespace exl
             struct matcher_when_exact {};
             struct matcher_otherwise {};
 
+            // exl::match of multiple exl::mixed values
+            struct matcher_when_all {};
+            struct matcher_when_all_exact {};
+
             // exl::box
             struct matcher_when_valid {};
         }
 
+        /// @brief Matcher of the specified kind. Func is deduced from the forwarding reference:
+        /// lvalue functors are stored by reference, rvalue functors are moved into the matcher,
+        /// so functors are never copied. Matchers of constexpr functors (e.g. C++17 lambdas) are
+        /// usable in constant expressions
         template <typename Kind, typename Target, typename Func>
         class matcher
         {
@@ -31,8 +41,8 @@ namespace exl
             using target_type_t = Target;
 
         public:
-            explicit matcher(Func rhs)
-                    : impl(rhs) {}
+            constexpr explicit matcher(Func&& rhs)
+                    : impl(std::forward<Func>(rhs)) {}
 
         public:
             Func impl;
@@ -48,6 +58,20 @@ namespace exl
     template <typename Func>
     using otherwise_t = impl::matcher<impl::marker::matcher_otherwise, void, Func>;
 
+    template <typename Func, typename ... Types>
+    using when_all_t = impl::matcher<
+            impl::marker::matcher_when_all,
+            impl::type_list<Types...>,
+            Func
+    >;
+
+    template <typename Func, typename ... Types>
+    using when_all_exact_t = impl::matcher<
+            impl::marker::matcher_when_all_exact,
+            impl::type_list<Types...>,
+            Func
+    >;
+
     template <typename Func>
     using when_valid_t = impl::matcher<impl::marker::matcher_when_valid, void, Func>;
 
@@ -61,7 +85,7 @@ namespace exl
                     Func
             >
     >
-    Matcher when(
+    constexpr Matcher when(
             Func&& func
     ) noexcept(std::is_rvalue_reference<decltype(std::forward<Func>(func))>::value)
     {
@@ -78,7 +102,7 @@ namespace exl
                     Func
             >
     >
-    Matcher when_exact(
+    constexpr Matcher when_exact(
             Func&& func
     ) noexcept(std::is_rvalue_reference<decltype(std::forward<Func>(func))>::value)
     {
@@ -94,13 +118,33 @@ namespace exl
                     Func
             >
     >
-    Matcher otherwise(
+    constexpr Matcher otherwise(
             Func&& func
     ) noexcept(std::is_rvalue_reference<decltype(std::forward<Func>(func))>::value)
     {
         return Matcher(std::forward<Func>(func));
     }
 
+    /// @brief Returns matcher of multiple exl::mixed values for non-strict "is same" comparison:
+    /// each value should be same as the corresponding type or derived from it. see exl::match
+    template <typename ... Types, typename Func>
+    constexpr when_all_t<Func, Types...> when_all(
+            Func&& func
+    ) noexcept(std::is_rvalue_reference<decltype(std::forward<Func>(func))>::value)
+    {
+        return when_all_t<Func, Types...>(std::forward<Func>(func));
+    }
+
+    /// @brief Returns matcher of multiple exl::mixed values for strict "is same" comparison: each
+    /// value should be exactly of the corresponding type. see exl::match
+    template <typename ... Types, typename Func>
+    constexpr when_all_exact_t<Func, Types...> when_all_exact(
+            Func&& func
+    ) noexcept(std::is_rvalue_reference<decltype(std::forward<Func>(func))>::value)
+    {
+        return when_all_exact_t<Func, Types...>(std::forward<Func>(func));
+    }
+
     /// @brief Returns matcher for case of valid exl::box pointer
     template <
             typename Func,
@@ -110,7 +154,7 @@ namespace exl
                     Func
             >
     >
-    Matcher when_valid(
+    constexpr Matcher when_valid(
             Func&& func
     ) noexcept(std::is_rvalue_reference<decltype(std::forward<Func>(func))>::value)
     {
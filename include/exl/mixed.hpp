@@ -6,18 +6,29 @@
 #pragma once
 
 #include <new>
+#include <cstddef>
 #include <type_traits>
 #include <exception>
 #include <utility>
 
 #include <exl/matchers.hpp>
 #include <exl/in_place.hpp>
+#include <exl/relocate.hpp>
 
-#include <exl/impl/mixed/mixed_storage_operations.hpp>
+#include <exl/impl/constexpr.hpp>
+#include <exl/impl/mixed/mixed_storage.hpp>
+#include <exl/impl/mixed/mixed_map_table.hpp>
+#include <exl/impl/mixed/mixed_policy.hpp>
+#include <exl/impl/mixed/mixed_slot.hpp>
 #include <exl/impl/mixed/markers.hpp>
 
 namespace exl
 {
+    namespace impl
+    {
+        struct mixed_access;
+    }
+
     /// @brief Represents tagged union type
     ///
     /// This class provides tagged union implementation. Any subset of instantiated class can be
@@ -26,56 +37,58 @@ namespace exl
     /// exl::mixed::unwrap() or indirect access methods like exl::mixed::map(), exl::mixed::when()
     /// exl::mixed::catch(), exl::mixed::unwrap_or, etc.
     ///
+    /// Type list may start with the storage policy (see exl::inline_budget), which is not a
+    /// variant itself and only affects how variants are stored
+    ///
+    /// Since C++14 mixed of trivially copyable variants is usable in constant expressions. The
+    /// exceptions keep the raw storage, which is runtime-only: variants with the size which is
+    /// not a multiple of their alignment (e.g. 5-byte struct with int), because the constexpr
+    /// storage would change the layout, and niche-optimized exl::option (see exl::niche_traits)
+    ///
     /// @tparam Types List of union variants
     template <typename ... Types>
-    class mixed : impl::marker::mixed
+    class mixed
+            : impl::marker::mixed
+            , impl::mixed_base<typename impl::mixed_policy<Types...>::storage_type_list_t>
     {
     public:
         template <typename ... FTypes>
         friend
         class mixed;
 
+        friend struct impl::mixed_access;
+
     public:
-        using tag_t = uint8_t;
-        using type_list_t = impl::type_list<Types...>;
-        using storage_t = typename std::aligned_storage<
-                impl::type_list_get_max_sizeof<type_list_t>::value(),
-                impl::type_list_get_max_alignof<type_list_t>::value()
-        >::type;
+        using type_list_t = typename impl::mixed_policy<Types...>::type_list_t;
+        /// @brief Type list of the storage slots. Differs from type_list_t only for variants
+        /// stored out of line by the storage policy; type ids are the same
+        using storage_type_list_t = typename impl::mixed_policy<Types...>::storage_type_list_t;
+        using tag_t = impl::type_list_compact_tag_t<type_list_t>;
+        using storage_t = typename impl::mixed_storage<storage_type_list_t>::storage_t;
 
     public:
-        /// @brief Copy-constructs self from exl::mixed of same type
-        mixed(const mixed<Types...>& rhs)
-                : storage_()
-                , tag_(0)
-        {
-            construct_from_subset_by_copy(rhs);
-        }
+        /// @brief Copy-constructs self from exl::mixed of same type. Trivial when all variants
+        /// are trivially copy-constructible
+        mixed(const mixed<Types...>& rhs) = default;
 
-        /// @brief Move-constructs self from exl::mixed of same type
-        mixed(mixed<Types...>&& rhs) noexcept
-                : storage_()
-                , tag_(0)
-        {
-            construct_from_subset_by_move(std::move(rhs));
-        }
+        /// @brief Move-constructs self from exl::mixed of same type. Trivial when all variants
+        /// are trivially move-constructible
+        mixed(mixed<Types...>&& rhs) noexcept = default;
 
         /// @brief Copy-constructs self from exl::mixed of different type
         template <typename ... RhsTypes>
         mixed(const mixed<RhsTypes...>& rhs)
-                : storage_()
-                , tag_(0)
+                : base_t(impl::mixed_storage_copy_t(), rhs)
         {
-            construct_from_subset_by_copy(rhs);
+            assert_storage_subset<mixed<RhsTypes...>>();
         }
 
         /// @brief Move-constructs self from exl::mixed of different type
         template <typename ... RhsTypes>
         mixed(mixed<RhsTypes...>&& rhs) noexcept
-                : storage_()
-                , tag_(0)
+                : base_t(impl::mixed_storage_move_t(), std::move(rhs))
         {
-            construct_from_subset_by_move(std::move(rhs));
+            assert_storage_subset<mixed<RhsTypes...>>();
         }
 
         /// @brief Constructs self from specific union variant of self
@@ -90,12 +103,10 @@ namespace exl
                 typename T = typename impl::type_list_get_best_match<type_list_t, U>::type,
                 typename = typename std::enable_if<std::is_constructible<T, U>::value>::type
         >
-        mixed(U&& rhs) noexcept(std::is_rvalue_reference<decltype(std::forward<U>(rhs))>::value)
-                : storage_()
-                , tag_(tag_of<T>())
-        {
-            construct_from<T>(std::forward<U>(rhs));
-        }
+        constexpr mixed(
+                U&& rhs
+        ) noexcept(std::is_rvalue_reference<decltype(std::forward<U>(rhs))>::value)
+                : base_t(in_place_type_t<slot_t<T>>(), tag_of<T>(), std::forward<U>(rhs)) {}
 
         /// @brief Constructs mixed with value constructed in-place
         /// @tparam U type to in-place construct
@@ -106,12 +117,12 @@ namespace exl
                 typename = typename std::enable_if<std::is_constructible<T, U>::value>::type,
                 typename ... Args
         >
-        explicit mixed(in_place_type_t<U>, Args&& ... args)
-                : storage_()
-                , tag_(tag_of<U>())
-        {
-            construct_in_place<U>(std::forward<Args>(args)...);
-        }
+        constexpr explicit mixed(in_place_type_t<U>, Args&& ... args)
+                : base_t(
+                        in_place_type_t<slot_t<U>>(),
+                        tag_of<U>(),
+                        std::forward<Args>(args)...
+                ) {}
 
         /// @brief Verbose alias for in-place construction
         template <typename U, typename ... Args>
@@ -137,13 +148,13 @@ namespace exl
 
             if (newTag == tag())
             {
-                unsafe_unwrap<T>() = rhs;
+                unsafe_unwrap_exact<T>() = rhs;
             }
             else
             {
                 destroy();
                 construct_from<T>(rhs);
-                tag_ = newTag;
+                base_t::set_tag(newTag);
             }
 
             return *this;
@@ -166,69 +177,32 @@ namespace exl
 
             if (newTag == tag())
             {
-                unsafe_unwrap<T>() = std::forward<U>(rhs);
+                unsafe_unwrap_exact<T>() = std::forward<U>(rhs);
             }
             else
             {
                 destroy();
                 construct_from<T>(std::forward<U>(rhs));
-                tag_ = newTag;
+                base_t::set_tag(newTag);
             }
 
             return *this;
         }
 
-        /// @brief Copy-assigns exl::mixed of the same type
-        mixed<Types...>& operator=(const mixed<Types...>& rhs)
-        {
-            if (tag_ != rhs.tag_)
-            {
-                destroy();
-                construct_from_subset_by_copy(rhs);
-            }
-            else
-            {
-                assign_from_subset_by_copy(rhs);
-            }
+        /// @brief Copy-assigns exl::mixed of the same type. Trivial when all variants are
+        /// trivially copyable
+        mixed<Types...>& operator=(const mixed<Types...>& rhs) = default;
 
-            return *this;
-        }
-
-        /// @brief Move-assigns exl::mixed of subset type
-        mixed<Types...>& operator=(mixed<Types...>&& rhs) noexcept
-        {
-            if (tag_ != rhs.tag_)
-            {
-                destroy();
-                construct_from_subset_by_move(std::move(rhs));
-            }
-            else
-            {
-                assign_from_subset_by_move(std::move(rhs));
-            }
-
-            return *this;
-        }
+        /// @brief Move-assigns exl::mixed of the same type. Trivial when all variants are
+        /// trivially copyable
+        mixed<Types...>& operator=(mixed<Types...>&& rhs) noexcept = default;
 
         /// @brief Copy-assigns exl::mixed of the subset type
         template <typename ... RhsTypes>
         mixed<Types...>& operator=(const mixed<RhsTypes...>& rhs)
         {
-            using IDMap = impl::type_list_subset_id_mapping<
-                    type_list_t,
-                    typename mixed<RhsTypes...>::type_list_t
-            >;
-
-            if (tag_ != IDMap::get(rhs.tag_))
-            {
-                destroy();
-                construct_from_subset_by_copy(rhs);
-            }
-            else
-            {
-                assign_from_subset_by_copy(rhs);
-            }
-
+            assert_storage_subset<mixed<RhsTypes...>>();
+            base_t::assign_by_copy(rhs);
             return *this;
         }
 
@@ -236,21 +210,8 @@ namespace exl
         template <typename ... RhsTypes>
         mixed<Types...>& operator=(mixed<RhsTypes...>&& rhs) noexcept
         {
-            using IDMap = impl::type_list_subset_id_mapping<
-                    type_list_t,
-                    typename mixed<RhsTypes...>::type_list_t
-            >;
-
-            if (tag_ != IDMap::get(rhs.tag_))
-            {
-                destroy();
-                construct_from_subset_by_move(std::move(rhs));
-            }
-            else
-            {
-                assign_from_subset_by_move(std::move(rhs));
-            }
-
+            assert_storage_subset<mixed<RhsTypes...>>();
+            base_t::assign_by_move(std::move(rhs));
             return *this;
         }
 
@@ -262,7 +223,23 @@ namespace exl
         {
             destroy();
             construct_in_place<U>(std::forward<Args>(args)...);
-            tag_ = tag_of<U>();
+            base_t::set_tag(tag_of<U>());
+        }
+
+        /// @brief Swaps values of two exl::mixed.
+        ///
+        /// exl::mixed of the trivially relocatable variants (see exl::is_trivially_relocatable) is
+        /// swapped bytewise without dispatch by tag. Otherwise values of the same type are swapped
+        /// in-place with the single dispatch, values of the different types are swapped by moves
+        void swap(mixed<Types...>& rhs) noexcept
+        {
+            swap_values(
+                    rhs,
+                    std::integral_constant<
+                            bool,
+                            is_trivially_relocatable<mixed<Types...>>::value()
+                    >()
+            );
         }
 
         /// @brief Checks if current stored variant is same as specified type U or derived from it
@@ -270,27 +247,18 @@ namespace exl
         /// @return True when stored type is same as specified type U or derived from it, false in
         /// other case.
         template <typename U>
-        bool is() const noexcept
+        EXL_CONSTEXPR14 bool is() const noexcept
         {
-            return
-                    impl::type_list_id_set_contains<
-                            typename impl::type_list_get_ids_of_derived_types<type_list_t, U>::type
-                    >::check(tag_)
-                            || impl::type_list_id_set_contains<
-                                    typename impl::type_list_get_ids_of_same_types<
-                                            type_list_t,
-                                            U
-                                    >::type
-                            >::check(tag_);
+            return impl::type_list_derived_id_mask<type_list_t, U>::contains(tag());
         }
 
         /// @brief Checks if current stored variant is same as specified type U
         /// @tparam U Type to perform check for
         /// @return True when stored type is same as specified type U, false in other case.
         template <typename U>
-        bool is_exact() const noexcept
+        EXL_CONSTEXPR14 bool is_exact() const noexcept
         {
-            return impl::type_list_get_type_id<type_list_t, U>::value() == tag_;
+            return impl::type_list_get_type_id<type_list_t, U>::value() == tag();
         }
 
         /// @brief Returns reference to the value with specified type.
@@ -304,7 +272,7 @@ namespace exl
         /// @tparam U Requested type to unwrap
         /// @return Reference to unwrapped type
         template <typename U>
-        U& unwrap() noexcept
+        EXL_CONSTEXPR14 U& unwrap() & noexcept
         {
             assert_type<U>();
             return unsafe_unwrap<U>();
@@ -321,12 +289,24 @@ namespace exl
         /// @tparam U Requested type to unwrap
         /// @return Const reference to unwrapped type
         template <typename U>
-        const U& unwrap() const noexcept
+        EXL_CONSTEXPR14 const U& unwrap() const& noexcept
         {
             assert_type<U>();
             return unsafe_unwrap<U>();
         }
 
+        /// @brief Returns rvalue reference to the value of the expiring exl::mixed, so the value
+        /// can be moved out of it. see exl::mixed::unwrap
+        ///
+        /// @tparam U Requested type to unwrap
+        /// @return Rvalue reference to unwrapped type
+        template <typename U>
+        EXL_CONSTEXPR14 U&& unwrap() && noexcept
+        {
+            assert_type<U>();
+            return std::move(unsafe_unwrap<U>());
+        }
+
         /// @brief Returns reference to the value with specified type.
         ///
         /// Calls std::terminate if stored type is not equal to the requested type.
@@ -337,10 +317,10 @@ namespace exl
         /// @tparam U Requested type to unwrap
         /// @return Reference to unwrapped type
         template <typename U>
-        U& unwrap_exact() noexcept
+        EXL_CONSTEXPR14 U& unwrap_exact() & noexcept
         {
             assert_type_exact<U>();
-            return unsafe_unwrap<U>();
+            return unsafe_unwrap_exact<U>();
         }
 
         /// @brief Returns const reference to the value with specified type.
@@ -353,10 +333,36 @@ namespace exl
         /// @tparam U Requested type to unwrap
         /// @return Const reference to unwrapped type
         template <typename U>
-        const U& unwrap_exact() const noexcept
+        EXL_CONSTEXPR14 const U& unwrap_exact() const& noexcept
         {
             assert_type_exact<U>();
-            return unsafe_unwrap<U>();
+            return unsafe_unwrap_exact<U>();
+        }
+
+        /// @brief Returns rvalue reference to the value of the expiring exl::mixed, so the value
+        /// can be moved out of it. see exl::mixed::unwrap_exact
+        ///
+        /// @tparam U Requested type to unwrap
+        /// @return Rvalue reference to unwrapped type
+        template <typename U>
+        EXL_CONSTEXPR14 U&& unwrap_exact() && noexcept
+        {
+            assert_type_exact<U>();
+            return std::move(unsafe_unwrap_exact<U>());
+        }
+
+        /// @brief Moves the value with specified type out of exl::mixed.
+        ///
+        /// Calls std::terminate if stored type is not equal to the requested type. Stored value
+        /// is left in the valid moved-from state, exl::mixed still holds the value of type U
+        ///
+        /// @tparam U Requested type to take
+        /// @return Value moved out of exl::mixed
+        template <typename U>
+        U take() noexcept
+        {
+            assert_type_exact<U>();
+            return std::move(unsafe_unwrap_exact<U>());
         }
 
         /// @brief calls func with argument as argument to requested type if contained type is
@@ -381,20 +387,43 @@ namespace exl
         {
             if (is_exact<U>())
             {
-                func(unsafe_unwrap<U>());
+                func(unsafe_unwrap_exact<U>());
             }
         }
 
         /// @brief exl::mixed visiting function. Set of matchers should cover all cases, otherwise
         /// code will not compile. see exl::when, exl::when_exact, exl::otherwise matchers.
         /// All functors of the matchers should return value of type U.
+        ///
+        /// For the large type lists matcher for each type is selected at compile time and map is
+        /// performed with the single indirect call (matchers are moved to the temporary storage)
         /// @tparam U return type of map expression
         /// @tparam Matchers set of matcher object types to perform match
         /// @param matchers set of matcher objects to perform match
         template <typename U, typename ... Matchers>
-        U map(Matchers&& ... matchers) const noexcept
+        EXL_CONSTEXPR14 U map(Matchers&& ... matchers) const& noexcept
         {
-            return map_internal<U, type_list_t>(std::forward<Matchers>(matchers)...);
+            return map_qualified<U, const mixed&>(*this, std::forward<Matchers>(matchers)...);
+        }
+
+        /// @brief exl::mixed visiting function, which passes the value to the matchers by
+        /// non-const reference, so it can be modified in-place. see exl::mixed::map
+        /// @tparam U return type of map expression
+        /// @param matchers set of matcher objects to perform match
+        template <typename U, typename ... Matchers>
+        EXL_CONSTEXPR14 U map(Matchers&& ... matchers) & noexcept
+        {
+            return map_qualified<U, mixed&>(*this, std::forward<Matchers>(matchers)...);
+        }
+
+        /// @brief exl::mixed visiting function for the expiring exl::mixed, which passes the value
+        /// to the matchers as rvalue, so it can be moved out without copy. see exl::mixed::map
+        /// @tparam U return type of map expression
+        /// @param matchers set of matcher objects to perform match
+        template <typename U, typename ... Matchers>
+        EXL_CONSTEXPR14 U map(Matchers&& ... matchers) && noexcept
+        {
+            return map_qualified<U, mixed&&>(*this, std::forward<Matchers>(matchers)...);
         }
 
         /// @brief exl::mixed visiting function. Set of matchers should cover all cases, otherwise
@@ -403,16 +432,34 @@ namespace exl
         /// @tparam Matchers set of matcher object types to perform match
         /// @param matchers set of matcher objects to perform match
         template <typename ... Matchers>
-        void match(Matchers&& ... matchers) const noexcept
+        EXL_CONSTEXPR14 void match(Matchers&& ... matchers) const& noexcept
         {
-            return map_internal<void, type_list_t>(std::forward<Matchers>(matchers)...);
+            return map<void>(std::forward<Matchers>(matchers)...);
+        }
+
+        /// @brief exl::mixed visiting function with void return type, which passes the value to
+        /// the matchers by non-const reference. see exl::mixed::map
+        /// @param matchers set of matcher objects to perform match
+        template <typename ... Matchers>
+        EXL_CONSTEXPR14 void match(Matchers&& ... matchers) & noexcept
+        {
+            return map<void>(std::forward<Matchers>(matchers)...);
+        }
+
+        /// @brief exl::mixed visiting function with void return type for the expiring
+        /// exl::mixed, which passes the value to the matchers as rvalue. see exl::mixed::map
+        /// @param matchers set of matcher objects to perform match
+        template <typename ... Matchers>
+        EXL_CONSTEXPR14 void match(Matchers&& ... matchers) && noexcept
+        {
+            return std::move(*this).template map<void>(std::forward<Matchers>(matchers)...);
         }
 
         /// @brief Returns current tag of mixed type. Please use returned value for check against
         /// exl::mixed::tag_of<T>()
-        tag_t tag() const noexcept
+        EXL_CONSTEXPR14 tag_t tag() const noexcept
         {
-            return tag_;
+            return tag_t(base_t::tag());
         }
 
         /// @brief Returns tag for type U
@@ -420,21 +467,26 @@ namespace exl
         template <typename U>
         static constexpr tag_t tag_of() noexcept
         {
-            return impl::type_list_get_type_id<type_list_t, U>::value();
-        }
-
-        /// Calls destructor for last stored variant in self
-        virtual ~mixed()
-        {
-            destroy();
+            return tag_t(impl::type_list_get_type_id<type_list_t, U>::value());
         }
 
     private:
-        using StorageOperations = impl::mixed_storage_operations<type_list_t, storage_t>;
+        using base_t = impl::mixed_base<storage_type_list_t>;
+
+        /// @brief Moves the value of exl::mixed, which has the same type id and storage type in
+        /// both exl::mixed types (see impl::mixed_storage_move_same_id_t)
+        template <typename ... RhsTypes>
+        mixed(impl::mixed_storage_move_same_id_t, mixed<RhsTypes...>&& rhs) noexcept
+                : base_t(impl::mixed_storage_move_same_id_t(), std::move(rhs)) {}
+
+        template <typename T>
+        using slot_t = typename impl::mixed_policy<Types...>::template slot_t<T>;
+
+        using base_t::storage_;
 
     private:
         template <typename U>
-        void assert_type() const noexcept
+        EXL_CONSTEXPR14 void assert_type() const noexcept
         {
             if (!is<U>())
             {
@@ -443,7 +495,7 @@ namespace exl
         }
 
         template <typename U>
-        void assert_type_exact() const noexcept
+        EXL_CONSTEXPR14 void assert_type_exact() const noexcept
         {
             if (!is_exact<U>())
             {
@@ -451,9 +503,50 @@ namespace exl
             }
         }
 
+        template <typename Rhs>
+        static void assert_storage_subset() noexcept
+        {
+            static_assert(
+                    impl::type_list_is_subset_of<
+                            typename impl::mixed_conversion_type_list<
+                                    typename Rhs::storage_type_list_t
+                            >::type,
+                            typename impl::mixed_conversion_type_list<storage_type_list_t>::type
+                    >::value(),
+                    "exl::mixed can be converted only from the subset with the same storage "
+                    "policy of the common variants (inline or out of line)"
+            );
+        }
+
         void destroy() noexcept
         {
-            StorageOperations::destroy(storage_, tag_);
+            base_t::destroy_value();
+        }
+
+        void swap_values(mixed<Types...>& rhs, std::true_type) noexcept
+        {
+            typename std::aligned_storage<
+                    sizeof(mixed<Types...>),
+                    alignof(mixed<Types...>)
+            >::type buffer;
+            auto tmp = reinterpret_cast<mixed<Types...>*>(&buffer);
+
+            exl::relocate(this, this + 1, tmp);
+            exl::relocate(&rhs, &rhs + 1, this);
+            exl::relocate(tmp, tmp + 1, &rhs);
+        }
+
+        void swap_values(mixed<Types...>& rhs, std::false_type) noexcept
+        {
+            if (tag() == rhs.tag())
+            {
+                base_t::storage_operations_t::swap(storage_, rhs.storage_, tag());
+                return;
+            }
+
+            mixed<Types...> tmp(std::move(rhs));
+            rhs = std::move(*this);
+            *this = std::move(tmp);
         }
 
         template <typename T, typename U>
@@ -461,127 +554,186 @@ namespace exl
                 U&& rhs
         ) noexcept(std::is_rvalue_reference<decltype(std::forward<U>(rhs))>::value)
         {
-            new(&storage_) (T)(std::forward<U>(rhs));
+            impl::mixed_slot_traits<slot_t<T>>::construct(&storage_, std::forward<U>(rhs));
+        }
+
+        template <typename T, typename ... Args>
+        void construct_in_place(Args&& ... args)
+        {
+            impl::mixed_slot_traits<slot_t<T>>::construct(&storage_, std::forward<Args>(args)...);
         }
 
         template <typename U>
-        void construct_from_subset_by_copy(const U& rhs)
+        EXL_CONSTEXPR14 U& unsafe_unwrap() noexcept
         {
-            using RhsStorageOperations = typename U::StorageOperations;
-            using RhsStorage = typename U::storage_t;
+            return unwrap_storage<U>(*this, uses_literal_union_t());
+        }
 
-            using RhsIDMap = impl::type_list_subset_id_mapping<
-                    type_list_t,
-                    typename U::type_list_t
-            >;
+        template <typename U>
+        EXL_CONSTEXPR14 const U& unsafe_unwrap() const noexcept
+        {
+            return unwrap_storage<U>(*this, uses_literal_union_t());
+        }
 
-            RhsStorageOperations::copy_construct_from(
-                    reinterpret_cast<RhsStorage&>(storage_),
-                    rhs.storage_,
-                    rhs.tag_
-            );
-            tag_ = RhsIDMap::get(rhs.tag_);
+        template <typename U>
+        EXL_CONSTEXPR14 U& unsafe_unwrap_exact() noexcept
+        {
+            return unwrap_storage_exact<U>(*this, uses_literal_union_t());
         }
 
         template <typename U>
-        void construct_from_subset_by_move(U&& rhs) noexcept
+        EXL_CONSTEXPR14 const U& unsafe_unwrap_exact() const noexcept
         {
-            using RhsStorageOperations = typename U::StorageOperations;
-            using RhsStorage = typename U::storage_t;
+            return unwrap_storage_exact<U>(*this, uses_literal_union_t());
+        }
+
+        // Values of the literal union are accessed through its members, so the access is
+        // allowed in constant expressions (see impl::mixed_literal_union)
+        using uses_literal_union_t = std::integral_constant<
+                bool,
+                impl::mixed_uses_literal_union<storage_type_list_t>::value()
+        >;
 
-            using RhsIDMap = impl::type_list_subset_id_mapping<
-                    type_list_t,
-                    typename U::type_list_t
-            >;
+        template <typename Self, typename U>
+        using qualified_t = impl::mixed_literal_qualified_t<Self, U>;
 
-            RhsStorageOperations::move_construct_from(
-                    reinterpret_cast<RhsStorage&>(storage_),
-                    std::move(rhs.storage_),
-                    rhs.tag_
+        template <typename U, typename Self>
+        static constexpr qualified_t<Self, U>& unwrap_storage(Self& self, std::true_type) noexcept
+        {
+            return storage_t::template get_derived<U>(self.storage_, self.tag());
+        }
+
+        template <typename U, typename Self>
+        static qualified_t<Self, U>& unwrap_storage(Self& self, std::false_type) noexcept
+        {
+            return impl::mixed_slot_cast<U, storage_type_list_t>::get(
+                    const_cast<storage_t*>(&self.storage_),
+                    self.tag()
             );
-            tag_ = RhsIDMap::get(rhs.tag_);
         }
 
-        template <typename T, typename ... Args>
-        void construct_in_place(Args&& ... args)
+        template <typename U, typename Self>
+        static constexpr qualified_t<Self, U>& unwrap_storage_exact(
+                Self& self,
+                std::true_type
+        ) noexcept
         {
-            new(&storage_) T(std::forward<Args>(args)...);
+            return storage_t::template get<U>(self.storage_);
         }
 
-        template <typename U>
-        void assign_from_subset_by_copy(const U& rhs)
+        template <typename U, typename Self>
+        static qualified_t<Self, U>& unwrap_storage_exact(Self& self, std::false_type) noexcept
         {
-            using RhsStorageOperations = typename U::StorageOperations;
-            using RhsStorage = typename U::storage_t;
+            return impl::mixed_slot_traits<slot_t<U>>::get(
+                    reinterpret_cast<qualified_t<Self, slot_t<U>>&>(self.storage_)
+            );
+        }
 
-            using RhsIDMap = impl::type_list_subset_id_mapping<
-                    type_list_t,
-                    typename U::type_list_t
-            >;
+        // Qualified is the reference to exl::mixed (const mixed&, mixed& or mixed&&), which
+        // defines constness and value category of the values passed to the matchers
+        template <typename Qualified>
+        using self_t = typename std::remove_reference<Qualified>::type;
 
-            RhsStorageOperations::copy_assign_from(
-                    reinterpret_cast<RhsStorage&>(storage_),
-                    rhs.storage_,
-                    rhs.tag_
+        template <typename Qualified, typename U>
+        static EXL_CONSTEXPR14 impl::mixed_forward_like_t<Qualified, U> forward_value(
+                self_t<Qualified>& self
+        )
+        {
+            return static_cast<impl::mixed_forward_like_t<Qualified, U>>(
+                    self.template unsafe_unwrap<U>()
             );
-            tag_ = RhsIDMap::get(rhs.tag_);
         }
 
-        template <typename U>
-        void assign_from_subset_by_move(U&& rhs) noexcept
+        template <typename Qualified, typename U>
+        static EXL_CONSTEXPR14 impl::mixed_forward_like_t<Qualified, U> forward_value_exact(
+                self_t<Qualified>& self
+        )
         {
-            using RhsStorageOperations = typename U::StorageOperations;
-            using RhsStorage = typename U::storage_t;
-
-            using RhsIDMap = impl::type_list_subset_id_mapping<
-                    type_list_t,
-                    typename U::type_list_t
-            >;
+            return static_cast<impl::mixed_forward_like_t<Qualified, U>>(
+                    self.template unsafe_unwrap_exact<U>()
+            );
+        }
 
-            RhsStorageOperations::move_assign_from(
-                    reinterpret_cast<RhsStorage&>(storage_),
-                    std::move(rhs.storage_),
-                    rhs.tag_
+        template <typename U, typename Qualified, typename ... Matchers>
+        static EXL_CONSTEXPR14 U map_qualified(
+                self_t<Qualified>& self,
+                Matchers&& ... matchers
+        ) noexcept
+        {
+            return map_dispatch<U, Qualified>(
+                    std::integral_constant<
+                            bool,
+                            (impl::type_list_get_size<type_list_t>::value()
+                                    >= impl::mixed_map_table_min_size)
+                    >(),
+                    self,
+                    std::forward<Matchers>(matchers)...
             );
-            tag_ = RhsIDMap::get(rhs.tag_);
         }
 
-        template <typename U>
-        U& unsafe_unwrap() noexcept
+        // Small type lists: matchers are checked sequentially, compiler is able to inline the
+        // whole chain. Allowed in constant expressions for the literal union storage
+        template <typename U, typename Qualified, typename ... Matchers>
+        static EXL_CONSTEXPR14 U map_dispatch(
+                std::false_type,
+                self_t<Qualified>& self,
+                Matchers&& ... matchers
+        ) noexcept
         {
-            return reinterpret_cast<U&>(storage_);
+            return map_internal<U, Qualified, type_list_t>(
+                    self,
+                    std::forward<Matchers>(matchers)...
+            );
         }
 
-        template <typename U>
-        const U& unsafe_unwrap() const noexcept
+        // Large type lists: matcher for each type is selected at compile time, single indirect
+        // call through the table indexed by tag
+        template <typename U, typename Qualified, typename ... Matchers>
+        static U map_dispatch(
+                std::true_type,
+                self_t<Qualified>& self,
+                Matchers&& ... matchers
+        ) noexcept
         {
-            return reinterpret_cast<const U&>(storage_);
+            using map_table_t = impl::mixed_map_table<U, storage_type_list_t, Matchers...>;
+
+            typename map_table_t::matchers_t matchersTuple(std::forward<Matchers>(matchers)...);
+            return map_table_t::template dispatch<impl::mixed_forward_like_t<Qualified, storage_t>>(
+                    self.storage_,
+                    self.tag(),
+                    matchersTuple
+            );
         }
 
-        template <typename U, typename TL, typename Matcher, typename ... Tail>
-        typename std::enable_if<
+        template <typename U, typename Qualified, typename TL, typename Matcher, typename ... Tail>
+        static EXL_CONSTEXPR14 typename std::enable_if<
                 std::is_same<typename Matcher::kind_t, impl::marker::matcher_when>::value,
                 U
-        >::type map_internal(Matcher&& matcher, Tail&& ... tail) const noexcept
+        >::type map_internal(
+                self_t<Qualified>& self,
+                Matcher&& matcher,
+                Tail&& ... tail
+        ) noexcept
         {
             using Target = typename Matcher::target_type_t;
-            if (is<Target>())
+            if (self.template is<Target>())
             {
-                return static_cast<U>(matcher.impl(unsafe_unwrap<Target>()));
+                return static_cast<U>(matcher.impl(forward_value<Qualified, Target>(self)));
             }
 
             return static_cast<U>(map_internal<
                     U,
+                    Qualified,
                     typename impl::type_list_remove_derived<
                             typename impl::type_list_remove_same<TL, Target>::type,
                             Target
                     >::type,
                     Tail...
-            >(std::forward<Tail>(tail)...));
+            >(self, std::forward<Tail>(tail)...));
         }
 
-        template <typename U, typename TL, typename Matcher>
-        typename std::enable_if<
+        template <typename U, typename Qualified, typename TL, typename Matcher>
+        static EXL_CONSTEXPR14 typename std::enable_if<
                 std::is_same<typename Matcher::kind_t, impl::marker::matcher_when>::value &&
                         std::is_same<
                                 typename impl::type_list_remove_derived<
@@ -594,32 +746,39 @@ namespace exl
                                 impl::type_list<>
                         >::value,
                 U
-        >::type map_internal(Matcher&& matcher) const noexcept
+        >::type map_internal(self_t<Qualified>& self, Matcher&& matcher) noexcept
         {
-            return static_cast<U>(matcher.impl(unsafe_unwrap<typename Matcher::target_type_t>()));
+            return static_cast<U>(matcher.impl(
+                    forward_value<Qualified, typename Matcher::target_type_t>(self)
+            ));
         }
 
-        template <typename U, typename TL, typename Matcher, typename ... Tail>
-        typename std::enable_if<
+        template <typename U, typename Qualified, typename TL, typename Matcher, typename ... Tail>
+        static EXL_CONSTEXPR14 typename std::enable_if<
                 std::is_same<typename Matcher::kind_t, impl::marker::matcher_when_exact>::value,
                 U
-        >::type map_internal(Matcher&& matcher, Tail&& ... tail) const noexcept
+        >::type map_internal(
+                self_t<Qualified>& self,
+                Matcher&& matcher,
+                Tail&& ... tail
+        ) noexcept
         {
             using Target = typename Matcher::target_type_t;
-            if (is_exact<Target>())
+            if (self.template is_exact<Target>())
             {
-                return static_cast<U>(matcher.impl(unsafe_unwrap<Target>()));
+                return static_cast<U>(matcher.impl(forward_value_exact<Qualified, Target>(self)));
             }
 
             return static_cast<U>(map_internal<
                     U,
+                    Qualified,
                     typename impl::type_list_remove_same<TL, Target>::type,
                     Tail...
-            >(std::forward<Tail>(tail)...));
+            >(self, std::forward<Tail>(tail)...));
         }
 
-        template <typename U, typename TL, typename Matcher>
-        typename std::enable_if<
+        template <typename U, typename Qualified, typename TL, typename Matcher>
+        static EXL_CONSTEXPR14 typename std::enable_if<
                 std::is_same<typename Matcher::kind_t, impl::marker::matcher_when_exact>::value &&
                         std::is_same<
                                 typename impl::type_list_remove_same<
@@ -629,25 +788,65 @@ namespace exl
                                 impl::type_list<>
                         >::value,
                 U
-        >::type map_internal(Matcher&& matcher) const noexcept
+        >::type map_internal(self_t<Qualified>& self, Matcher&& matcher) noexcept
         {
-            return static_cast<U>(matcher.impl(unsafe_unwrap<typename Matcher::target_type_t>()));
+            return static_cast<U>(matcher.impl(
+                    forward_value_exact<Qualified, typename Matcher::target_type_t>(self)
+            ));
         }
 
-        template <typename U, typename TL = type_list_t, typename Matcher, typename ... Tail>
-        typename std::enable_if<
+        template <
+                typename U,
+                typename Qualified,
+                typename TL = type_list_t,
+                typename Matcher,
+                typename ... Tail
+        >
+        static EXL_CONSTEXPR14 typename std::enable_if<
                 std::is_same<typename Matcher::kind_t, impl::marker::matcher_otherwise>::value,
                 U
-        >::type map_internal(Matcher&& matcher) const noexcept
+        >::type map_internal(self_t<Qualified>&, Matcher&& matcher) noexcept
         {
             return static_cast<U>(matcher.impl());
         }
-
-    private:
-        storage_t storage_;
-        tag_t tag_;
     };
 
+    namespace impl
+    {
+        /// @brief Provides unchecked access to the exl::mixed value for the library internals
+        struct mixed_access
+        {
+            template <typename U, typename ... Types>
+            static const U& unsafe_unwrap(const mixed<Types...>& value) noexcept
+            {
+                return value.template unsafe_unwrap_exact<U>();
+            }
+
+            template <typename ... Types>
+            static const typename mixed<Types...>::storage_t& storage(
+                    const mixed<Types...>& value
+            ) noexcept
+            {
+                return value.storage_;
+            }
+
+            template <typename ... Types>
+            static typename mixed<Types...>::storage_t& storage(mixed<Types...>& value) noexcept
+            {
+                return value.storage_;
+            }
+
+            /// @brief Constructs exl::mixed by move of the value, which has the same type id and
+            /// storage type in both exl::mixed types. Storage is moved without dispatch by tag
+            /// when it is trivially copyable, tag is stored as is
+            template <typename Mixed, typename ... RhsTypes>
+            static Mixed move_same_id(mixed<RhsTypes...>&& rhs) noexcept
+            {
+                return Mixed(mixed_storage_move_same_id_t(), std::move(rhs));
+            }
+        };
+    }
+
     /// @brief Wrapper type to allow nested exl::mixed types
     ///
     /// To make nested exl::variant, declare type for example as in the following snippet
@@ -698,4 +897,97 @@ namespace exl
     private:
         mixed_t value_;
     };
-}
\ No newline at end of file
+
+    /// @brief Provides compile-time information about memory layout of exl::mixed
+    ///
+    /// Tag is placed right after the storage of the largest variant. When size of the largest
+    /// variant is not a multiple of the storage alignment, tag occupies the storage tail padding
+    /// and does not increase size of the exl::mixed at all.
+    ///
+    /// @tparam Mixed exl::mixed type (or type derived from it, e.g. exl::option)
+    template <typename Mixed>
+    struct mixed_layout
+    {
+    private:
+        using mixed_storage_t = impl::mixed_storage<typename Mixed::storage_type_list_t>;
+
+    public:
+        /// @brief Returns size of the exl::mixed type
+        static constexpr size_t size() { return sizeof(Mixed); }
+
+        /// @brief Returns alignment of the exl::mixed type
+        static constexpr size_t alignment() { return alignof(Mixed); }
+
+        /// @brief Returns size of the storage for union variants
+        static constexpr size_t storage_size()
+        {
+            return sizeof(typename mixed_storage_t::storage_t);
+        }
+
+        /// @brief Returns offset of the storage for union variants
+        static constexpr size_t storage_offset() { return offsetof(mixed_storage_t, storage_); }
+
+        /// @brief Returns size of the tag. Zero, when tag is encoded in the niche value
+        static constexpr size_t tag_size()
+        {
+            return impl::mixed_tag_layout<typename Mixed::storage_type_list_t>::size();
+        }
+
+        /// @brief Returns offset of the tag
+        static constexpr size_t tag_offset()
+        {
+            return impl::mixed_tag_layout<typename Mixed::storage_type_list_t>::offset();
+        }
+
+        /// @brief Returns true when exl::none is represented by the niche value of the value type
+        /// (see exl::niche_traits), so there is no separate tag at all
+        static constexpr bool is_niche_optimized()
+        {
+            return impl::mixed_is_niche_optimizable<
+                    typename Mixed::storage_type_list_t
+            >::value();
+        }
+
+        /// @brief Returns count of unused padding bytes
+        static constexpr size_t padding() { return size() - storage_size() - tag_size(); }
+
+        /// @brief Returns true when tag does not increase the size of exl::mixed, i.e. its size
+        /// is equal to the size of the largest variant rounded up to the alignment
+        static constexpr bool is_tag_packed()
+        {
+            return size() == (storage_size() + alignment() - 1) / alignment() * alignment();
+        }
+    };
+
+    /// @brief exl::mixed holds no pointers to itself, so it is trivially relocatable when all of
+    /// its storage slots are
+    template <typename ... Types>
+    struct is_trivially_relocatable<mixed<Types...>>
+    {
+        static constexpr bool value()
+        {
+            return impl::mixed_slots_trivially_relocatable<
+                    typename mixed<Types...>::storage_type_list_t
+            >::value();
+        }
+    };
+
+    template <typename ... Types>
+    struct is_trivially_relocatable<nested_mixed<Types...>>
+    {
+        static constexpr bool value()
+        {
+            return is_trivially_relocatable<typename nested_mixed<Types...>::mixed_t>::value();
+        }
+    };
+}
+
+namespace std
+{
+    /// @brief std::swap specialization for exl::mixed<Types...>
+    template <typename ... Types>
+    void swap(exl::mixed<Types...>& lhs, exl::mixed<Types...>& rhs) noexcept
+    {
+        lhs.swap(rhs);
+    }
+}
@@ -0,0 +1,513 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <exl/in_place.hpp>
+#include <exl/matchers.hpp>
+#include <exl/mixed.hpp>
+
+#include <exl/impl/mixed/type_list.hpp>
+#include <exl/impl/mixed_vector/mixed_vector_pools.hpp>
+#include <exl/impl/mixed_vector/tag_scan.hpp>
+
+namespace exl
+{
+    /// @brief Sequence of exl::mixed values with the struct-of-arrays layout.
+    ///
+    /// Instead of the array of exl::mixed, each padded to the largest variant, the vector keeps
+    /// the dense array of tags, the array of indices and the separate contiguous pool of values
+    /// for each variant type. Element costs its own value plus the tag and the 32-bit index, so
+    /// scans over the values of the single type (see exl::mixed_vector::for_each_of) and over
+    /// tags (see exl::mixed_vector::count, exl::mixed_vector::find) touch only the memory they
+    /// need.
+    ///
+    /// Elements are accessed through the proxy references which provide the exl::mixed read
+    /// interface (is, unwrap, map, ...). Type of the element can't be changed after insertion.
+    /// As for exl::mixed::unwrap, misuse (access out of range, pop_back of the empty vector,
+    /// scan range out of bounds) calls std::terminate.
+    ///
+    /// ```
+    /// exl::mixed_vector<Click, Scroll, KeyPress> events;
+    /// events.push_back(Click { 10, 20 });
+    /// events.push_back(Scroll { -3 });
+    ///
+    /// events.for_each_of<Click>([](const Click& click) { handle(click); });
+    /// size_t keys = events.count<KeyPress>();
+    /// ```
+    ///
+    /// @note Pools are std::vector: allocation failure is reported as for std::vector. Each pool
+    /// can hold at most UINT32_MAX values, std::terminate is called on overflow
+    ///
+    /// @tparam Types List of the variant types
+    template <typename ... Types>
+    class mixed_vector
+    {
+    private:
+        using pools_t = impl::mixed_vector_pools<impl::type_list<Types...>>;
+
+    public:
+        template <bool Const>
+        class basic_reference;
+
+        template <bool Const>
+        class basic_iterator;
+
+        using type_list_t = impl::type_list<Types...>;
+        using mixed_t = mixed<Types...>;
+        using tag_t = impl::type_list_compact_tag_t<type_list_t>;
+        using index_t = typename pools_t::index_t;
+
+        using reference = basic_reference<false>;
+        using const_reference = basic_reference<true>;
+        using iterator = basic_iterator<false>;
+        using const_iterator = basic_iterator<true>;
+
+    public:
+        /// @brief Proxy reference to the element of exl::mixed_vector, provides the read
+        /// interface of exl::mixed. Values are accessed by const reference when Const is true
+        template <bool Const>
+        class basic_reference
+        {
+        public:
+            using vector_t = typename std::conditional<
+                    Const,
+                    const mixed_vector,
+                    mixed_vector
+            >::type;
+
+            template <typename U>
+            using value_ref_t = typename std::conditional<Const, const U&, U&>::type;
+
+        public:
+            basic_reference(vector_t& vector, size_t position) noexcept
+                    : vector_(&vector)
+                    , position_(position) {}
+
+            /// @brief Converts reference to the reference to const
+            operator basic_reference<true>() const noexcept
+            {
+                return basic_reference<true>(*vector_, position_);
+            }
+
+            /// @brief Returns tag of the element, see exl::mixed::tag. Calls std::terminate if
+            /// the element is out of the vector range (all element access goes through it)
+            tag_t tag() const noexcept
+            {
+                if (position_ >= vector_->size())
+                {
+                    std::terminate();
+                }
+
+                return vector_->tags_[position_];
+            }
+
+            /// @brief Checks if element is of type U or derived from it, see exl::mixed::is
+            template <typename U>
+            bool is() const noexcept
+            {
+                return impl::type_list_derived_id_mask<type_list_t, U>::contains(tag());
+            }
+
+            /// @brief Checks if element is of type U, see exl::mixed::is_exact
+            template <typename U>
+            bool is_exact() const noexcept
+            {
+                return mixed_vector::tag_of<U>() == tag();
+            }
+
+            /// @brief Returns reference to the value of type U or derived from it. Calls
+            /// std::terminate if element is of the other type. see exl::mixed::unwrap
+            template <typename U>
+            value_ref_t<U> unwrap() const noexcept
+            {
+                return map<value_ref_t<U>>(
+                        exl::when<U>([](value_ref_t<U> value) -> value_ref_t<U>
+                        {
+                            return value;
+                        }),
+                        exl::otherwise([]() -> value_ref_t<U>
+                        {
+                            std::terminate();
+                        })
+                );
+            }
+
+            /// @brief Returns reference to the value of type U. Calls std::terminate if element
+            /// is of the other type. see exl::mixed::unwrap_exact
+            template <typename U>
+            value_ref_t<U> unwrap_exact() const noexcept
+            {
+                if (!is_exact<U>())
+                {
+                    std::terminate();
+                }
+
+                return pools_t::template get<U>(
+                        vector_->pools_.template pool<U>()[vector_->indices_[position_]]
+                );
+            }
+
+            /// @brief Visiting function, see exl::mixed::map. Matcher is selected with the single
+            /// indirect call
+            template <typename U, typename ... Matchers>
+            U map(Matchers&& ... matchers) const noexcept
+            {
+                using Pools = typename std::conditional<Const, const pools_t&, pools_t&>::type;
+
+                std::tuple<typename std::decay<Matchers>::type...> matchersTuple(
+                        std::forward<Matchers>(matchers)...
+                );
+
+                return pools_t::template map<Pools, U, Matchers...>(
+                        vector_->pools_,
+                        tag(),
+                        vector_->indices_[position_],
+                        matchersTuple
+                );
+            }
+
+            /// @brief Visiting function with void return type, see exl::mixed::match
+            template <typename ... Matchers>
+            void match(Matchers&& ... matchers) const noexcept
+            {
+                return map<void>(std::forward<Matchers>(matchers)...);
+            }
+
+            /// @brief Returns copy of the element as exl::mixed
+            mixed_t to_mixed() const
+            {
+                return map<mixed_t>(exl::when_exact<Types>(to_mixed_converter())...);
+            }
+
+        private:
+            struct to_mixed_converter
+            {
+                template <typename T>
+                mixed_t operator()(const T& value) const
+                {
+                    return mixed_t(in_place_type_t<T>(), value);
+                }
+            };
+
+        private:
+            vector_t* vector_;
+            size_t position_;
+        };
+
+        /// @brief Iterator over exl::mixed_vector elements, dereferences to the proxy reference
+        template <bool Const>
+        class basic_iterator
+        {
+        public:
+            using vector_t = typename basic_reference<Const>::vector_t;
+
+            using iterator_category = std::input_iterator_tag;
+            using value_type = mixed_t;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = basic_reference<Const>;
+
+        public:
+            basic_iterator(vector_t& vector, size_t position) noexcept
+                    : vector_(&vector)
+                    , position_(position) {}
+
+            reference operator*() const noexcept
+            {
+                return reference(*vector_, position_);
+            }
+
+            basic_iterator& operator++() noexcept
+            {
+                ++position_;
+                return *this;
+            }
+
+            basic_iterator operator++(int) noexcept
+            {
+                auto previous = *this;
+                ++position_;
+                return previous;
+            }
+
+            bool operator==(const basic_iterator& rhs) const noexcept
+            {
+                return position_ == rhs.position_ && vector_ == rhs.vector_;
+            }
+
+            bool operator!=(const basic_iterator& rhs) const noexcept
+            {
+                return !(*this == rhs);
+            }
+
+        private:
+            vector_t* vector_;
+            size_t position_;
+        };
+
+    public:
+        /// @brief Appends value; stored type is selected as for exl::mixed construction
+        template <
+                typename U,
+                typename Decayed = typename std::decay<U>::type,
+                typename = typename std::enable_if<
+                        !std::is_base_of<impl::marker::mixed, Decayed>::value
+                >::type,
+                typename T = typename impl::type_list_get_best_match<type_list_t, U>::type,
+                typename = typename std::enable_if<std::is_constructible<T, U>::value>::type
+        >
+        void push_back(U&& value)
+        {
+            emplace_back<T>(std::forward<U>(value));
+        }
+
+        /// @brief Appends value of type U constructed in-place
+        template <typename U, typename ... Args>
+        void emplace_back(Args&& ... args)
+        {
+            static_assert(
+                    impl::type_list_has_type<type_list_t, U>::value(),
+                    "Type is not one of the exl::mixed_vector types"
+            );
+
+            auto& pool = pools_.template pool<U>();
+            if (pool.size() >= size_t(UINT32_MAX))
+            {
+                std::terminate();
+            }
+
+            // Tags and indices are reserved first, so nothing is changed when allocation or the
+            // value constructor throws, and push_back after the value insertion can't throw
+            reserve_next(tags_);
+            reserve_next(indices_);
+
+            pool.emplace_back(std::forward<Args>(args)...);
+            indices_.push_back(index_t(pool.size() - 1));
+            tags_.push_back(tag_of<U>());
+        }
+
+        /// @brief Removes the last element. Calls std::terminate if vector is empty
+        void pop_back() noexcept
+        {
+            if (empty())
+            {
+                std::terminate();
+            }
+
+            pools_.pop_back(tags_.back());
+            indices_.pop_back();
+            tags_.pop_back();
+        }
+
+        /// @brief Removes all elements
+        void clear() noexcept
+        {
+            pools_.clear();
+            indices_.clear();
+            tags_.clear();
+        }
+
+        /// @brief Reserves space for the tags and indices of the specified elements count
+        void reserve(size_t capacity)
+        {
+            tags_.reserve(capacity);
+            indices_.reserve(capacity);
+        }
+
+        /// @brief Reserves space in the pool of type U for the specified values count
+        template <typename U>
+        void reserve_of(size_t capacity)
+        {
+            pools_.template pool<U>().reserve(capacity);
+        }
+
+        /// @brief Returns elements count
+        size_t size() const noexcept
+        {
+            return tags_.size();
+        }
+
+        /// @brief Returns true if vector has no elements
+        bool empty() const noexcept
+        {
+            return tags_.empty();
+        }
+
+        /// @brief Returns reference to the element at position. Access through the reference
+        /// calls std::terminate if position is out of range
+        reference operator[](size_t position) noexcept
+        {
+            return reference(*this, position);
+        }
+
+        /// @brief Returns const reference to the element at position. Access through the
+        /// reference calls std::terminate if position is out of range
+        const_reference operator[](size_t position) const noexcept
+        {
+            return const_reference(*this, position);
+        }
+
+        iterator begin() noexcept { return iterator(*this, 0); }
+        iterator end() noexcept { return iterator(*this, size()); }
+
+        const_iterator begin() const noexcept { return const_iterator(*this, 0); }
+        const_iterator end() const noexcept { return const_iterator(*this, size()); }
+
+        /// @brief Calls func for each value of type U in the insertion order. Values are read
+        /// from the contiguous pool of type U, other elements are not touched
+        template <typename U, typename Func>
+        void for_each_of(Func&& func)
+        {
+            for (auto& value : pools_.template pool<U>())
+            {
+                func(pools_t::template get<U>(value));
+            }
+        }
+
+        /// @brief Calls func for each value of type U in the insertion order by const reference.
+        /// see exl::mixed_vector::for_each_of
+        template <typename U, typename Func>
+        void for_each_of(Func&& func) const
+        {
+            for (const auto& value : pools_.template pool<U>())
+            {
+                func(pools_t::template get<U>(value));
+            }
+        }
+
+        /// @brief Returns count of elements of type U or derived from it
+        template <typename U>
+        size_t count() const noexcept
+        {
+            return count<U>(0, size());
+        }
+
+        /// @brief Returns count of elements of type U or derived from it in [first, last).
+        /// Tags are compared with SIMD instructions where available. Calls std::terminate if
+        /// range is not within [0, size()]
+        template <typename U>
+        size_t count(size_t first, size_t last) const noexcept
+        {
+            assert_range(first, last);
+
+            return tag_scan_t::count(
+                    tags_.data() + first,
+                    last - first,
+                    derived_tags_t<U>::data(),
+                    derived_tags_t<U>::size()
+            );
+        }
+
+        /// @brief Returns count of elements of type U
+        template <typename U>
+        size_t count_exact() const noexcept
+        {
+            return pools_.template pool<U>().size();
+        }
+
+        /// @brief Returns count of elements of type U in [first, last). see
+        /// exl::mixed_vector::count
+        template <typename U>
+        size_t count_exact(size_t first, size_t last) const noexcept
+        {
+            assert_range(first, last);
+
+            const tag_t target = tag_of<U>();
+            return tag_scan_t::count(tags_.data() + first, last - first, &target, 1);
+        }
+
+        /// @brief Returns position of the first element of type U or derived from it starting
+        /// from the position first, or size() when there is no such element. Tags are compared
+        /// with SIMD instructions where available. Calls std::terminate if first > size()
+        template <typename U>
+        size_t find(size_t first = 0) const noexcept
+        {
+            assert_range(first, size());
+
+            return first + tag_scan_t::find(
+                    tags_.data() + first,
+                    size() - first,
+                    derived_tags_t<U>::data(),
+                    derived_tags_t<U>::size()
+            );
+        }
+
+        /// @brief Returns position of the first element of type U starting from the position
+        /// first, or size() when there is no such element. see exl::mixed_vector::find
+        template <typename U>
+        size_t find_exact(size_t first = 0) const noexcept
+        {
+            assert_range(first, size());
+
+            const tag_t target = tag_of<U>();
+            return first + tag_scan_t::find(tags_.data() + first, size() - first, &target, 1);
+        }
+
+        /// @brief Returns tag of type U, see exl::mixed::tag_of
+        template <typename U>
+        static constexpr tag_t tag_of() noexcept
+        {
+            return mixed_t::template tag_of<U>();
+        }
+
+    private:
+        using tag_scan_t = impl::tag_scan<tag_t>;
+
+        void assert_range(size_t first, size_t last) const noexcept
+        {
+            if (first > last || last > size())
+            {
+                std::terminate();
+            }
+        }
+
+        // Makes room for one more element with the geometric growth of std::vector::push_back
+        template <typename V>
+        static void reserve_next(V& values)
+        {
+            if (values.size() == values.capacity())
+            {
+                values.reserve(values.empty() ? 1 : values.size() * 2);
+            }
+        }
+
+        // Compile-time table of the tags of U and types derived from it
+        template <typename IdSet>
+        struct tag_table;
+
+        template <impl::type_list_tag_t ... Ids>
+        struct tag_table<impl::type_list_id_set<Ids...>>
+        {
+            static constexpr size_t size() noexcept { return sizeof...(Ids); }
+
+            static const tag_t* data() noexcept
+            {
+                // Trailing tag keeps the array non-empty when no type matches
+                static constexpr tag_t tags[] = { tag_t(Ids)..., tag_t(0) };
+                return tags;
+            }
+        };
+
+        template <typename U>
+        using derived_tags_t = tag_table<
+                typename impl::type_list_derived_id_mask<type_list_t, U>::ids_t
+        >;
+
+    private:
+        std::vector<tag_t> tags_;
+        std::vector<index_t> indices_;
+        pools_t pools_;
+    };
+}
@@ -0,0 +1,58 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <new>
+
+namespace exl
+{
+    /// @brief Describes invalid ("niche") value of type T, which allows exl::option<T> to be
+    /// stored without separate tag: exl::none is represented by the niche value itself.
+    ///
+    /// To declare niche for the custom type, specialize this template with the following members:
+    /// ```
+    /// template <>
+    /// struct exl::niche_traits<Index>
+    /// {
+    ///     static constexpr bool has_niche() { return true; }
+    ///
+    ///     // Returns true if value is niche (exl::option<Index> holds exl::none)
+    ///     static bool is_niche(const Index& value) noexcept { return value.get() == UINT32_MAX; }
+    ///
+    ///     // Constructs niche value in the provided raw storage
+    ///     static void construct_niche(void* storage) noexcept { new(storage) Index(UINT32_MAX); }
+    /// };
+    /// ```
+    ///
+    /// @warning Niche value can't be held by exl::option as a value: exl::option holding niche
+    /// value is indistinguishable from exl::option holding exl::none. Construction, copy and
+    /// destruction of the niche value should be nothrow.
+    ///
+    /// @tparam T type to describe niche for
+    template <typename T>
+    struct niche_traits
+    {
+        /// @brief Returns true if niche value is declared for the type
+        static constexpr bool has_niche() { return false; }
+    };
+
+    /// @brief Niche of the pointer types is nullptr
+    template <typename T>
+    struct niche_traits<T*>
+    {
+        static constexpr bool has_niche() { return true; }
+
+        static bool is_niche(T* const& value) noexcept
+        {
+            return value == nullptr;
+        }
+
+        static void construct_niche(void* storage) noexcept
+        {
+            new(storage) (T*)(nullptr);
+        }
+    };
+}
@@ -5,25 +5,62 @@
 
 #pragma once
 
+#include <type_traits>
+
 #include <exl/mixed.hpp>
 #include <exl/none.hpp>
+#include <exl/relocate.hpp>
+
+#include <exl/impl/constexpr.hpp>
 
 namespace exl
 {
+    template <typename T>
+    class option;
+
+    namespace impl
+    {
+        /// @brief Checks if forwarded arguments are the single exl::option of the same type, so
+        /// the copy or move of the option should be selected instead of the forwarding
+        template <typename Option, typename ... Args>
+        struct is_option_self_arg
+        {
+            static constexpr bool value() { return false; }
+        };
+
+        template <typename Option, typename Arg>
+        struct is_option_self_arg<Option, Arg>
+        {
+            static constexpr bool value()
+            {
+                return std::is_same<Option, typename std::decay<Arg>::type>::value;
+            }
+        };
+    }
+
     /// @brief class for representation of optional values.
     ///
     /// Based on exl::mixed type with addition of useful methods for mixed type with single
-    /// optional variant
+    /// optional variant. When exl::niche_traits declares the niche value of T, exl::none is
+    /// represented by it and option has the size of T. Option is converted to and from
+    /// exl::mixed<T, exl::none>, which always keeps the separate tag
     template <typename T>
-    class option : public mixed<T, exl::none>
+    class option : public mixed<impl::mixed_option_policy, T, exl::none>
     {
     public:
-        using base_mixed_t = mixed<T, exl::none>;
+        using base_mixed_t = mixed<impl::mixed_option_policy, T, exl::none>;
 
     public:
         /// @brief Forwards construction to exl::mixed. see exl::mixed::mixed
-        template <typename ... Args>
-        option(Args&& ... args)
+        /// Copy from the non-const lvalue option is left to the copy constructor, which is
+        /// trivial for the trivially copyable T
+        template <
+                typename ... Args,
+                typename = typename std::enable_if<
+                        !impl::is_option_self_arg<option<T>, Args...>::value()
+                >::type
+        >
+        constexpr option(Args&& ... args)
                 : base_mixed_t(std::forward<Args>(args)...) {}
 
         /// @brief Verbose alias for in-place construction
@@ -54,36 +91,57 @@ namespace exl
         }
 
         /// @brief Forwards assignment to exl::mixed. see exl::mixed::operator=
-        template <typename U>
+        template <
+                typename U,
+                typename = typename std::enable_if<
+                        !impl::is_option_self_arg<option<T>, U>::value()
+                >::type
+        >
         option<T>& operator=(U&& rhs) noexcept
         {
             return reinterpret_cast<option<T>&>(base_mixed_t::operator=(std::forward<U>(rhs)));
         }
 
         /// @brief Returns true if object is exl::none
-        bool is_none() const noexcept
+        EXL_CONSTEXPR14 bool is_none() const noexcept
         {
             return base_mixed_t::template is<exl::none>();
         }
 
         /// @brief Returns true of object is not exl::none
-        bool is_some() const noexcept
+        EXL_CONSTEXPR14 bool is_some() const noexcept
         {
             return !is_none();
         }
 
         /// @brief Returns reference to contained value. Calls std::terminate if
         /// object has exl::none
-        T& unwrap_some() noexcept
+        EXL_CONSTEXPR14 T& unwrap_some() noexcept
         {
             return base_mixed_t::template unwrap<T>();
         }
 
         /// @brief Returns const reference to contained value. Calls std::terminate if
         /// object has exl::none
-        const T& unwrap_some() const noexcept
+        EXL_CONSTEXPR14 const T& unwrap_some() const noexcept
         {
             return base_mixed_t::template unwrap<T>();
         }
     };
-}
\ No newline at end of file
+
+    template <typename T>
+    struct is_trivially_relocatable<option<T>>
+    {
+        static constexpr bool value() { return is_trivially_relocatable<mixed<T, none>>::value(); }
+    };
+}
+
+namespace std
+{
+    /// @brief std::swap specialization for exl::option<T>
+    template <typename T>
+    void swap(exl::option<T>& lhs, exl::option<T>& rhs) noexcept
+    {
+        lhs.swap(rhs);
+    }
+}
@@ -0,0 +1,159 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+#include <exl/match_batch.hpp>
+#include <exl/thread_pool.hpp>
+
+namespace exl
+{
+    namespace impl
+    {
+        /// @brief Minimal count of values processed by the single task of the parallel algorithm
+        constexpr size_t parallel_min_chunk_size = 2048;
+
+        /// @brief Count of chunks per pool thread. Smaller chunks balance the load when
+        /// processing time differs between the values
+        constexpr size_t parallel_chunks_per_thread = 8;
+
+        /// @brief Splits range of values to the chunks processed by the single pool task each
+        class parallel_chunks
+        {
+        public:
+            parallel_chunks(size_t size, size_t concurrency) noexcept
+                    : size_(size)
+                    , chunkSize_(chunk_size(size, concurrency))
+            {}
+
+            /// @brief Returns count of chunks
+            size_t count() const noexcept
+            {
+                return (size_ + chunkSize_ - 1) / chunkSize_;
+            }
+
+            /// @brief Returns offset of the first value of the chunk
+            size_t begin(size_t chunk) const noexcept
+            {
+                return chunk * chunkSize_;
+            }
+
+            /// @brief Returns offset past the last value of the chunk
+            size_t end(size_t chunk) const noexcept
+            {
+                return size_ - begin(chunk) > chunkSize_ ? begin(chunk) + chunkSize_ : size_;
+            }
+
+        private:
+            static size_t chunk_size(size_t size, size_t concurrency) noexcept
+            {
+                const size_t chunksCount = concurrency * parallel_chunks_per_thread;
+                const size_t chunkSize = (size + chunksCount - 1) / chunksCount;
+                return chunkSize > parallel_min_chunk_size ? chunkSize : parallel_min_chunk_size;
+            }
+
+        private:
+            size_t size_;
+            size_t chunkSize_;
+        };
+    }
+
+    /// @brief Parallel version of exl::match_batch: range of exl::mixed values (or derived types
+    /// like exl::option) is split to chunks, which are processed by the threads of the pool.
+    ///
+    /// Each chunk is processed as by exl::match_batch with its own copy of the matchers, so
+    /// matchers which modify own state are not shared between threads, while data captured by
+    /// reference is accessed concurrently and should be synchronized by the caller. Matchers
+    /// should report failures as values (e.g. exl::result) and not throw: as for the other exl
+    /// matching functions, exception which leaves the matcher terminates the program.
+    ///
+    /// @param pool thread pool which executes the chunks
+    /// @param first, last random access iterators of the range
+    /// @param matchers matcher objects
+    template <typename Iterator, typename ... Matchers>
+    void parallel_match(
+            thread_pool& pool,
+            Iterator first,
+            Iterator last,
+            Matchers&& ... matchers
+    ) noexcept
+    {
+        using batch_map_t = impl::mixed_batch_map_t<void, Iterator, Matchers...>;
+        using difference_t = typename std::iterator_traits<Iterator>::difference_type;
+
+        const typename batch_map_t::matchers_t matchersTuple(std::forward<Matchers>(matchers)...);
+        const impl::parallel_chunks chunks(static_cast<size_t>(last - first), pool.concurrency());
+
+        auto task = [first, &chunks, &matchersTuple](size_t chunk)
+        {
+            auto chunkMatchers = matchersTuple;
+            batch_map_t::match_range(
+                    first + static_cast<difference_t>(chunks.begin(chunk)),
+                    first + static_cast<difference_t>(chunks.end(chunk)),
+                    chunkMatchers
+            );
+        };
+
+        pool.run(chunks.count(), task);
+    }
+
+    /// @brief Parallel version of exl::map_batch: results for the range of exl::mixed values
+    /// are computed by the threads of the pool and assigned to the output range in the range
+    /// order (see exl::parallel_match for the chunking and matchers requirements).
+    ///
+    /// Errors of the processing are reported as values of the output range: matchers return
+    /// exl::result or exl::mixed with the error alternatives.
+    /// ```
+    /// std::vector<exl::result<Record, ParseError>> records(rows.size());
+    /// exl::parallel_transform<exl::result<Record, ParseError>>(
+    ///     pool, rows.begin(), rows.end(), records.begin(),
+    ///     exl::when<CsvRow>([](const CsvRow& row) { return parse_csv(row); }),
+    ///     exl::when<JsonRow>([](const JsonRow& row) { return parse_json(row); }));
+    /// ```
+    ///
+    /// @tparam U return type of map expression
+    /// @param pool thread pool which executes the chunks
+    /// @param first, last random access iterators of the range
+    /// @param out random access iterator to the output range of at least (last - first)
+    /// assignable values
+    /// @param matchers matcher objects
+    /// @return Iterator past the last written output value
+    template <typename U, typename Iterator, typename OutputIterator, typename ... Matchers>
+    OutputIterator parallel_transform(
+            thread_pool& pool,
+            Iterator first,
+            Iterator last,
+            OutputIterator out,
+            Matchers&& ... matchers
+    ) noexcept
+    {
+        using batch_map_t = impl::mixed_batch_map_t<U, Iterator, Matchers...>;
+        using difference_t = typename std::iterator_traits<Iterator>::difference_type;
+        using out_difference_t = typename std::iterator_traits<OutputIterator>::difference_type;
+
+        const typename batch_map_t::matchers_t matchersTuple(std::forward<Matchers>(matchers)...);
+        const auto size = static_cast<size_t>(last - first);
+        const impl::parallel_chunks chunks(size, pool.concurrency());
+
+        auto task = [first, out, &chunks, &matchersTuple](size_t chunk)
+        {
+            auto chunkMatchers = matchersTuple;
+            batch_map_t::map_range(
+                    first + static_cast<difference_t>(chunks.begin(chunk)),
+                    first + static_cast<difference_t>(chunks.end(chunk)),
+                    out + static_cast<out_difference_t>(chunks.begin(chunk)),
+                    chunkMatchers
+            );
+        };
+
+        pool.run(chunks.count(), task);
+
+        return out + static_cast<out_difference_t>(size);
+    }
+}
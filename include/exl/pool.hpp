@@ -0,0 +1,285 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <exl/box.hpp>
+
+#include <exl/details/box/pool_deleter.hpp>
+
+#include <exl/impl/hints.hpp>
+
+namespace exl
+{
+    /// @brief exl::box of the value allocated from exl::pool
+    template <typename T>
+    using pool_box = box<T, pool_deleter<T>>;
+
+    namespace impl
+    {
+        /// @brief Returns id of the calling thread. Ids are taken from the monotonic counter, so
+        /// unlike thread-local addresses and std::thread::id they are never reused by the threads
+        /// started after the owner has exited
+        inline uint64_t pool_thread_id() noexcept
+        {
+            static std::atomic<uint64_t> last(0);
+            static thread_local const uint64_t id =
+                    last.fetch_add(1, std::memory_order_relaxed) + 1;
+            return id;
+        }
+    }
+
+    /// @brief Pool of the fixed-size slots for the values of type T, owned by the thread which
+    /// created it.
+    ///
+    /// exl::pool::make constructs the value in the recycled slot when there is one, so the hot
+    /// path is the pop from the free list without heap allocation. Slots are allocated from the
+    /// heap in chunks. Box returns the slot to the pool on destruction: slots freed by the owner
+    /// thread are pushed to the free list, slots freed by other threads are pushed to the
+    /// lock-free return queue, which is taken by the owner when its free list is empty.
+    /// ```
+    /// thread_local exl::pool<Order> orders;
+    /// auto order = orders.make(id, price);
+    /// queue.push(std::move(order)); // may be destroyed on the other thread
+    /// ```
+    ///
+    /// @warning exl::pool::make should be called only by the owner thread. All boxes of the pool
+    /// should be destroyed before the pool destruction
+    template <typename T>
+    class pool
+    {
+    public:
+        static_assert(!std::is_array<T>::value, "exl::pool supports only scalar types");
+
+        template <typename U>
+        friend class pool_deleter;
+
+    public:
+        /// @brief Count of slots in the chunk by default
+        static constexpr size_t default_chunk_size()
+        {
+            return 64;
+        }
+
+    public:
+        /// @brief Creates pool owned by the calling thread. No memory is allocated until the
+        /// first exl::pool::make
+        explicit pool(size_t chunkSize = default_chunk_size()) noexcept
+                : owner_(impl::pool_thread_id())
+                , chunkSize_(chunkSize != 0 ? chunkSize : default_chunk_size())
+                , chunks_(nullptr)
+                , freeList_(nullptr)
+                , unused_(nullptr)
+                , unusedEnd_(nullptr)
+                , returned_(nullptr)
+                , hits_(0)
+                , misses_(0) {}
+
+        pool(const pool&) = delete;
+        pool& operator=(const pool&) = delete;
+
+        /// @brief Frees all chunks of the pool
+        ~pool() noexcept
+        {
+            while (chunks_ != nullptr)
+            {
+                chunk* previous = chunks_->previous;
+                ::operator delete(chunks_);
+                chunks_ = previous;
+            }
+        }
+
+        /// @brief Creates value of type T in the slot of the pool
+        ///
+        /// When the slot can't be allocated, is_valid() of the box will return false
+        ///
+        /// @param args object constructor arguments
+        /// @return box which returns the slot to the pool on destruction
+        template <typename ... Args>
+        pool_box<T> make(Args&& ... args)
+        noexcept(std::is_nothrow_constructible<T, Args...>::value)
+        {
+            rollback guard(*this, acquire());
+            if (guard.get() == nullptr)
+            {
+                return pool_box<T>(nullptr);
+            }
+
+            new(guard.get()->storage) T(std::forward<Args>(args)...);
+            return pool_box<T>(reinterpret_cast<T*>(guard.release()->storage));
+        }
+
+        /// @brief Returns count of values created in the recycled slots
+        size_t hits() const noexcept
+        {
+            return hits_;
+        }
+
+        /// @brief Returns count of values created in the slots which were never used before,
+        /// including failed allocations
+        size_t misses() const noexcept
+        {
+            return misses_;
+        }
+
+    private:
+        struct slot
+        {
+            union
+            {
+                slot* next;
+                alignas(T) unsigned char storage[sizeof(T)];
+            };
+
+            pool* owner;
+        };
+
+        struct alignas(slot) chunk
+        {
+            chunk* previous;
+
+            slot* slots() noexcept
+            {
+                return reinterpret_cast<slot*>(this + 1);
+            }
+        };
+
+        static_assert(
+                alignof(T) <= alignof(std::max_align_t),
+                "exl::pool supports only types with the fundamental alignment"
+        );
+
+        /// @brief Returns acquired slot to the free list when value constructor throws
+        class rollback
+        {
+        public:
+            rollback(pool& owner, slot* acquired) noexcept
+                    : owner_(owner)
+                    , slot_(acquired) {}
+
+            rollback(const rollback&) = delete;
+            rollback& operator=(const rollback&) = delete;
+
+            ~rollback() noexcept
+            {
+                if (slot_ != nullptr)
+                {
+                    slot_->next = owner_.freeList_;
+                    owner_.freeList_ = slot_;
+                }
+            }
+
+            slot* get() const noexcept
+            {
+                return slot_;
+            }
+
+            slot* release() noexcept
+            {
+                slot* acquired = slot_;
+                slot_ = nullptr;
+                return acquired;
+            }
+
+        private:
+            pool& owner_;
+            slot* slot_;
+        };
+
+    private:
+        slot* acquire() noexcept
+        {
+            if (EXL_LIKELY(freeList_ != nullptr)
+                    || returned_.load(std::memory_order_relaxed) != nullptr)
+            {
+                if (freeList_ == nullptr)
+                {
+                    freeList_ = returned_.exchange(nullptr, std::memory_order_acquire);
+                }
+
+                slot* recycled = freeList_;
+                freeList_ = recycled->next;
+                ++hits_;
+                return recycled;
+            }
+
+            ++misses_;
+            return carve();
+        }
+
+        EXL_COLD slot* carve() noexcept
+        {
+            if (unused_ == unusedEnd_)
+            {
+                void* memory = ::operator new(
+                        sizeof(chunk) + chunkSize_ * sizeof(slot),
+                        std::nothrow
+                );
+                if (memory == nullptr)
+                {
+                    return nullptr;
+                }
+
+                chunks_ = new(memory) chunk { chunks_ };
+                unused_ = chunks_->slots();
+                unusedEnd_ = unused_ + chunkSize_;
+            }
+
+            slot* carved = unused_++;
+            carved->owner = this;
+            return carved;
+        }
+
+        /// @brief Returns slot of the destroyed value to its pool
+        static void recycle(T* obj) noexcept
+        {
+            // Value storage is the first member of the standard layout slot
+            slot* freed = reinterpret_cast<slot*>(obj);
+            pool* owner = freed->owner;
+
+            if (EXL_LIKELY(owner->owner_ == impl::pool_thread_id()))
+            {
+                freed->next = owner->freeList_;
+                owner->freeList_ = freed;
+                return;
+            }
+
+            slot* head = owner->returned_.load(std::memory_order_relaxed);
+            do
+            {
+                freed->next = head;
+            }
+            while (!owner->returned_.compare_exchange_weak(
+                    head,
+                    freed,
+                    std::memory_order_release,
+                    std::memory_order_relaxed
+            ));
+        }
+
+    private:
+        uint64_t owner_;
+        size_t chunkSize_;
+        chunk* chunks_;
+
+        // Owner thread state
+        slot* freeList_;
+        slot* unused_;
+        slot* unusedEnd_;
+
+        // Slots freed by other threads, taken by the owner all at once
+        std::atomic<slot*> returned_;
+
+        size_t hits_;
+        size_t misses_;
+    };
+}
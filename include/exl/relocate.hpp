@@ -0,0 +1,114 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <new>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+namespace exl
+{
+    /// @brief Describes if objects of type T can be relocated (moved to the other address, with
+    /// the source object being destroyed) by the plain copy of their bytes. True for the trivially
+    /// copyable types by default.
+    ///
+    /// Types which hold no pointers to themselves (e.g. owning pointers) are trivially
+    /// relocatable even when their copy and move are not trivial. To declare it for the custom
+    /// type, specialize this template:
+    /// ```
+    /// template <>
+    /// struct exl::is_trivially_relocatable<Handle>
+    /// {
+    ///     static constexpr bool value() { return true; }
+    /// };
+    /// ```
+    ///
+    /// @tparam T type to describe
+    template <typename T>
+    struct is_trivially_relocatable
+    {
+        /// @brief Returns true if type is trivially relocatable
+        static constexpr bool value() { return std::is_trivially_copyable<T>::value; }
+    };
+
+    namespace impl
+    {
+        /// @brief Checks if all provided types are trivially relocatable
+        template <typename ... Types>
+        struct is_trivially_relocatable_all;
+
+        template <>
+        struct is_trivially_relocatable_all<>
+        {
+            static constexpr bool value() { return true; }
+        };
+
+        template <typename Head, typename ... Tail>
+        struct is_trivially_relocatable_all<Head, Tail...>
+        {
+            static constexpr bool value()
+            {
+                return is_trivially_relocatable<Head>::value()
+                        && is_trivially_relocatable_all<Tail...>::value();
+            }
+        };
+
+        template <typename T>
+        T* relocate(T* first, T* last, T* dest, std::true_type) noexcept
+        {
+            const auto count = static_cast<size_t>(last - first);
+
+            // Cast to void* disables warnings about raw copy of the non-trivial types, which is
+            // allowed by exl::is_trivially_relocatable
+            std::memcpy(
+                    static_cast<void*>(dest),
+                    static_cast<const void*>(first),
+                    count * sizeof(T)
+            );
+            return dest + count;
+        }
+
+        template <typename T>
+        T* relocate(T* first, T* last, T* dest, std::false_type) noexcept
+        {
+            static_assert(
+                    std::is_nothrow_move_constructible<T>::value,
+                    "exl::relocate requires type to be nothrow move-constructible or trivially "
+                    "relocatable"
+            );
+
+            for (; first != last; ++first, ++dest)
+            {
+                new(dest) T(std::move(*first));
+                first->~T();
+            }
+
+            return dest;
+        }
+    }
+
+    /// @brief Relocates objects of the range [first, last) to the uninitialized memory starting
+    /// at dest: objects are moved to the new location and the source objects are destroyed.
+    ///
+    /// Trivially relocatable types (see exl::is_trivially_relocatable) are relocated with the
+    /// single memcpy of the whole range, others are move-constructed and destroyed one by one.
+    ///
+    /// @warning Source and destination ranges should not overlap
+    ///
+    /// @return Pointer past the last relocated object in the destination range
+    template <typename T>
+    T* relocate(T* first, T* last, T* dest) noexcept
+    {
+        return impl::relocate(
+                first,
+                last,
+                dest,
+                std::integral_constant<bool, is_trivially_relocatable<T>::value()>()
+        );
+    }
+}
@@ -0,0 +1,456 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <cstddef>
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+#include <exl/in_place.hpp>
+#include <exl/inline_budget.hpp>
+#include <exl/matchers.hpp>
+#include <exl/mixed.hpp>
+#include <exl/relocate.hpp>
+
+#include <exl/impl/hints.hpp>
+#include <exl/impl/mixed/mixed_map_table.hpp>
+#include <exl/impl/mixed/mixed_slot.hpp>
+#include <exl/impl/mixed/type_list.hpp>
+
+namespace exl
+{
+    template <typename T, typename ... Errors>
+    class result;
+
+    namespace impl
+    {
+        /// @brief Checks if provided type is exl::result
+        template <typename T>
+        struct is_result
+        {
+            static constexpr bool value() { return false; }
+        };
+
+        template <typename T, typename ... Errors>
+        struct is_result<result<T, Errors...>>
+        {
+            static constexpr bool value() { return true; }
+        };
+
+        /// @brief Error of the exl::result, which is propagated to the caller result (see
+        /// exl::result::propagate_error). Implicitly converts to exl::result.
+        ///
+        /// Refers to the source result, so it should be converted in the same expression in
+        /// which it was created (as EXL_TRY does): it can't be copied or moved out of
+        /// exl::result, and the conversion accepts only rvalues
+        template <typename Result>
+        class result_propagated_error
+        {
+        public:
+            template <typename U, typename ... Errors>
+            friend class exl::result;
+
+        public:
+            result_propagated_error& operator=(const result_propagated_error&) = delete;
+            result_propagated_error& operator=(result_propagated_error&&) = delete;
+
+            Result& source() const noexcept
+            {
+                return source_;
+            }
+
+        private:
+            explicit result_propagated_error(Result& source) noexcept
+                    : source_(source) {}
+
+            result_propagated_error(const result_propagated_error&) = default;
+            result_propagated_error(result_propagated_error&&) noexcept = default;
+
+        private:
+            Result& source_;
+        };
+
+        /// @brief Checks if provided type is impl::result_propagated_error
+        template <typename T>
+        struct is_result_propagated_error
+        {
+            static constexpr bool value() { return false; }
+        };
+
+        template <typename Result>
+        struct is_result_propagated_error<result_propagated_error<Result>>
+        {
+            static constexpr bool value() { return true; }
+        };
+
+        /// @brief Returns storage type list of the exl::result errors: storage type list of the
+        /// underlying exl::mixed without the value
+        template <typename StorageTL>
+        struct result_error_slots;
+
+        template <typename Value, typename ... Errors>
+        struct result_error_slots<type_list<Value, Errors...>>
+        {
+            using type = type_list<Errors...>;
+        };
+
+        /// @brief Constructs exl::mixed with the error moved out of the propagated result
+        template <typename Mixed, typename E>
+        struct result_error_converter
+        {
+            Mixed operator()(E&& error) const
+            {
+                return Mixed(in_place_type_t<E>(), std::move(error));
+            }
+        };
+
+        /// @brief Returns inline budget of the exl::result with value type T: errors which fit
+        /// into the storage of the value or the heap error storage never increase the result size
+        template <typename T>
+        struct result_inline_budget
+        {
+            static constexpr size_t value()
+            {
+                return sizeof(T) > sizeof(mixed_boxed<T>) ? sizeof(T) : sizeof(mixed_boxed<T>);
+            }
+        };
+    }
+
+    /// @brief Represents result of the fallible operation: value of type T or one of the errors.
+    ///
+    /// Built on exl::mixed with the layout optimized for the success path. Errors which don't fit
+    /// into the storage of T (or the single pointer) are kept in the heap (see
+    /// exl::inline_budget) and allocated only when the error is actually returned, so size of the
+    /// result is the size of T plus tag regardless of the error types. Error handling paths are
+    /// placed out of line.
+    ///
+    /// ```
+    /// exl::result<Config, ParseError, IoError> load_config();
+    ///
+    /// auto config = load_config();
+    /// if (config.is_ok()) { use(config.unwrap_ok()); }
+    /// ```
+    ///
+    /// @note Failed allocation of the heap error storage calls std::terminate
+    ///
+    /// @tparam T Value type
+    /// @tparam Errors List of error types
+    template <typename T, typename ... Errors>
+    class result
+    {
+    public:
+        template <typename U, typename ... RhsErrors>
+        friend class result;
+
+    public:
+        using value_t = T;
+        using type_list_t = impl::type_list<T, Errors...>;
+        using mixed_t = mixed<
+                inline_budget<impl::result_inline_budget<T>::value()>,
+                T,
+                Errors...
+        >;
+
+        static_assert(sizeof...(Errors) > 0, "exl::result should have at least one error type");
+        static_assert(
+                !impl::type_list_has_type<impl::type_list<Errors...>, T>::value(),
+                "exl::result value type should not be one of the error types"
+        );
+
+    public:
+        result(const result&) = default;
+        result(result&&) noexcept = default;
+        result& operator=(const result&) = default;
+        result& operator=(result&&) noexcept = default;
+
+        /// @brief Constructs result from the value or from the error. Alternative is selected
+        /// as for exl::mixed construction
+        template <
+                typename U,
+                typename Decayed = typename std::decay<U>::type,
+                typename = typename std::enable_if<
+                        !impl::is_result<Decayed>::value() &&
+                                !impl::is_result_propagated_error<Decayed>::value() &&
+                                !impl::is_in_place_type_t<Decayed>::value()
+                >::type,
+                typename V = typename impl::type_list_get_best_match<type_list_t, U>::type,
+                typename = typename std::enable_if<std::is_constructible<V, U>::value>::type
+        >
+        result(U&& rhs)
+                : result(in_place_type_t<V>(), std::forward<U>(rhs)) {}
+
+        /// @brief Constructs value or error of type V in-place
+        template <typename V, typename ... Args>
+        explicit result(in_place_type_t<V>, Args&& ... args)
+                : value_(in_place_type_t<V>(), std::forward<Args>(args)...) {}
+
+        /// @brief Constructs result with the error moved out of the other result (see
+        /// exl::result::propagate_error and EXL_TRY). Error types of the source result should be
+        /// a subset of the error types of this result.
+        ///
+        /// When error types of the source result are the trailing error types of this result in
+        /// the same order and with the same storage, error and tag are moved as is, without
+        /// dispatch by the error type
+        template <typename U, typename ... RhsErrors>
+        result(impl::result_propagated_error<result<U, RhsErrors...>>&& error) noexcept
+                : value_(propagate(
+                        std::move(error.source().value_),
+                        std::integral_constant<bool, impl::type_list_is_suffix_of<
+                                typename impl::result_error_slots<
+                                        typename result<U, RhsErrors...>::mixed_t
+                                                ::storage_type_list_t
+                                >::type,
+                                typename mixed_t::storage_type_list_t
+                        >::value()>()
+                ))
+        {
+            static_assert(
+                    impl::type_list_is_subset_of<
+                            impl::type_list<RhsErrors...>,
+                            impl::type_list<Errors...>
+                    >::value(),
+                    "exl::result error can be propagated only to the result with the superset "
+                    "of its error types"
+            );
+        }
+
+        /// @brief Returns result with value constructed in-place
+        template <typename ... Args>
+        static result make_ok(Args&& ... args)
+        {
+            return result(in_place_type_t<T>(), std::forward<Args>(args)...);
+        }
+
+        /// @brief Returns result with error of type E constructed in-place
+        template <typename E, typename ... Args>
+        static result make_error(Args&& ... args)
+        {
+            static_assert(
+                    impl::type_list_has_type<impl::type_list<Errors...>, E>::value(),
+                    "Type is not one of the exl::result error types"
+            );
+
+            return result(in_place_type_t<E>(), std::forward<Args>(args)...);
+        }
+
+        /// @brief Returns true if result holds the value
+        bool is_ok() const noexcept
+        {
+            return value_.tag() == mixed_t::template tag_of<T>();
+        }
+
+        /// @brief Returns true if result holds any of the errors
+        bool is_error() const noexcept
+        {
+            return !is_ok();
+        }
+
+        /// @brief Returns true if result holds error of type E or derived from it
+        template <typename E>
+        bool is_error() const noexcept
+        {
+            return is_error() && impl::type_list_derived_id_mask<type_list_t, E>::contains(
+                    value_.tag()
+            );
+        }
+
+        /// @brief Returns reference to the value. Calls std::terminate if result holds error
+        T& unwrap_ok() & noexcept
+        {
+            return value_.template unwrap_exact<T>();
+        }
+
+        /// @brief Returns const reference to the value. Calls std::terminate if result holds
+        /// error
+        const T& unwrap_ok() const& noexcept
+        {
+            return value_.template unwrap_exact<T>();
+        }
+
+        /// @brief Returns rvalue reference to the value of the expiring result. Calls
+        /// std::terminate if result holds error
+        T&& unwrap_ok() && noexcept
+        {
+            return std::move(value_).template unwrap_exact<T>();
+        }
+
+        /// @brief Returns the error for propagation to the caller: implicitly converts to any
+        /// exl::result, which error types are superset of this result error types. Error is moved
+        /// out of this result on conversion. Calls std::terminate if result holds value
+        ///
+        /// see EXL_TRY
+        impl::result_propagated_error<result> propagate_error() && noexcept
+        {
+            if (is_ok())
+            {
+                std::terminate();
+            }
+
+            return impl::result_propagated_error<result>(*this);
+        }
+
+        /// @brief Returns reference to the error of type E or derived from it. Calls
+        /// std::terminate if result holds value or error of the other type
+        template <typename E>
+        const E& unwrap_error() const noexcept
+        {
+            if (is_ok())
+            {
+                std::terminate();
+            }
+
+            return map<const E&>(
+                    exl::when<E>([](const E& error) -> const E&
+                    {
+                        return error;
+                    }),
+                    exl::otherwise([]() -> const E&
+                    {
+                        std::terminate();
+                    })
+            );
+        }
+
+        /// @brief Visiting function, see exl::mixed::map. Matchers receive the value or the
+        /// error itself, regardless of where it is stored.
+        ///
+        /// Matcher of the value is invoked directly, errors are dispatched through the table of
+        /// functions on the cold path
+        ///
+        /// @tparam U return type of map expression
+        /// @param matchers set of matcher objects to perform match
+        template <typename U, typename ... Matchers>
+        U map(Matchers&& ... matchers) const noexcept
+        {
+            using map_table_t = impl::mixed_map_table<
+                    U,
+                    typename mixed_t::storage_type_list_t,
+                    Matchers...
+            >;
+            using storage_t = typename mixed_t::storage_t;
+
+            typename map_table_t::matchers_t matchersTuple(std::forward<Matchers>(matchers)...);
+
+            if (EXL_LIKELY(is_ok()))
+            {
+                return map_table_t::template call_as<const storage_t&, T>(
+                        impl::mixed_access::storage(value_),
+                        matchersTuple
+                );
+            }
+
+            return map_error<map_table_t>(value_, matchersTuple);
+        }
+
+        /// @brief Visiting function with void return type, see exl::result::map
+        template <typename ... Matchers>
+        void match(Matchers&& ... matchers) const noexcept
+        {
+            return map<void>(std::forward<Matchers>(matchers)...);
+        }
+
+        /// @brief Swaps two results, see exl::mixed::swap
+        void swap(result& rhs) noexcept
+        {
+            value_.swap(rhs.value_);
+        }
+
+        /// @brief Returns underlying exl::mixed, which holds either the value or one of the
+        /// errors
+        const mixed_t& as_mixed() const noexcept
+        {
+            return value_;
+        }
+
+    private:
+        template <typename RhsMixed>
+        static mixed_t propagate(RhsMixed&& error, std::true_type) noexcept
+        {
+            return impl::mixed_access::move_same_id<mixed_t>(std::move(error));
+        }
+
+        template <typename ... RhsTypes>
+        static mixed_t propagate(mixed<RhsTypes...>&& error, std::false_type) noexcept
+        {
+            return propagate(
+                    std::move(error),
+                    static_cast<typename mixed<RhsTypes...>::type_list_t*>(nullptr)
+            );
+        }
+
+        template <typename RhsMixed, typename RhsValue, typename ... RhsErrors>
+        static mixed_t propagate(RhsMixed&& error, impl::type_list<RhsValue, RhsErrors...>*)
+        {
+            return std::move(error).template map<mixed_t>(
+                    exl::when_exact<RhsErrors>(
+                            impl::result_error_converter<mixed_t, RhsErrors>()
+                    )...,
+                    exl::otherwise([]() -> mixed_t
+                    {
+                        std::terminate();
+                    })
+            );
+        }
+
+        template <typename MapTable>
+        EXL_COLD static typename MapTable::result_t map_error(
+                const mixed_t& value,
+                typename MapTable::matchers_t& matchers
+        ) noexcept
+        {
+            return MapTable::template dispatch<const typename mixed_t::storage_t&>(
+                    impl::mixed_access::storage(value),
+                    value.tag(),
+                    matchers
+            );
+        }
+
+    private:
+        mixed_t value_;
+    };
+
+    template <typename T, typename ... Errors>
+    struct is_trivially_relocatable<result<T, Errors...>>
+    {
+        static constexpr bool value()
+        {
+            return is_trivially_relocatable<typename result<T, Errors...>::mixed_t>::value();
+        }
+    };
+}
+
+namespace std
+{
+    /// @brief std::swap specialization for exl::result<T, Errors...>
+    template <typename T, typename ... Errors>
+    void swap(exl::result<T, Errors...>& lhs, exl::result<T, Errors...>& rhs) noexcept
+    {
+        lhs.swap(rhs);
+    }
+}
+
+#define EXL_TRY_CONCAT_IMPL(lhs, rhs) lhs##rhs
+#define EXL_TRY_CONCAT(lhs, rhs) EXL_TRY_CONCAT_IMPL(lhs, rhs)
+
+/// @brief Evaluates expression, which returns exl::result. Declares variable with the result
+/// value on success, returns the error from the enclosing function otherwise. Error types of the
+/// expression result should be a subset of the error types of the function result.
+///
+/// ```
+/// exl::result<Config, ParseError, IoError> load_config()
+/// {
+///     EXL_TRY(std::string text, read_file("config.json")); // exl::result<std::string, IoError>
+///     return parse(text);
+/// }
+/// ```
+#define EXL_TRY(declaration, expression) \
+    auto EXL_TRY_CONCAT(exl_try_result_, __LINE__) = (expression); \
+    if (EXL_UNLIKELY(EXL_TRY_CONCAT(exl_try_result_, __LINE__).is_error())) \
+    { \
+        return std::move(EXL_TRY_CONCAT(exl_try_result_, __LINE__)).propagate_error(); \
+    } \
+    declaration = std::move(EXL_TRY_CONCAT(exl_try_result_, __LINE__)).unwrap_ok()
@@ -0,0 +1,190 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <exl/impl/exceptions.hpp>
+
+namespace exl
+{
+    /// @brief Fixed set of worker threads for the data-parallel algorithms (see
+    /// exl::parallel_match and exl::parallel_transform).
+    ///
+    /// Workers are started once on construction and sleep between jobs. Thread which calls
+    /// exl::thread_pool::run participates in the job too, so pool with N workers runs tasks on
+    /// N + 1 threads. When the worker thread can't be started, pool keeps the workers which were
+    /// started successfully: jobs are still completed, with lower concurrency
+    class thread_pool
+    {
+    public:
+        /// @brief Creates pool with worker for each hardware thread except the calling one
+        thread_pool() noexcept
+                : thread_pool(default_workers_count())
+        {}
+
+        /// @brief Creates pool with specified count of the worker threads
+        explicit thread_pool(size_t workersCount) noexcept
+        {
+            workers_.reserve(workersCount);
+            for (size_t i = 0; i < workersCount && spawn_worker(); ++i) {}
+        }
+
+        thread_pool(const thread_pool&) = delete;
+        thread_pool& operator=(const thread_pool&) = delete;
+
+        /// @brief Stops and joins all worker threads
+        ~thread_pool() noexcept
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                stop_ = true;
+            }
+            wakeCondition_.notify_all();
+
+            for (auto& worker : workers_)
+            {
+                worker.join();
+            }
+        }
+
+        /// @brief Returns count of threads which execute jobs: workers and the calling thread
+        size_t concurrency() const noexcept
+        {
+            return workers_.size() + 1;
+        }
+
+        /// @brief Invokes task(index) for each index in [0, count) on the pool workers and the
+        /// calling thread, returns when all invocations are completed. Indices are distributed
+        /// dynamically, so the task may be invoked for any of them on any thread. Concurrent
+        /// calls of run are executed one after another
+        template <typename Task>
+        void run(size_t count, Task& task) noexcept
+        {
+            std::lock_guard<std::mutex> runLock(runMutex_);
+
+            job current;
+            current.invoke = &invoke<Task>;
+            current.task = &task;
+            current.count = count;
+            current.next.store(0, std::memory_order_relaxed);
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                job_ = &current;
+                ++generation_;
+            }
+            wakeCondition_.notify_all();
+
+            execute(current);
+
+            // Job is owned by this call, so it is detached only when no workers execute it
+            std::unique_lock<std::mutex> lock(mutex_);
+            doneCondition_.wait(lock, [this]() { return active_ == 0; });
+            job_ = nullptr;
+        }
+
+    private:
+        struct job
+        {
+            void (*invoke)(void*, size_t);
+            void* task;
+            size_t count;
+            std::atomic<size_t> next;
+        };
+
+    private:
+        static size_t default_workers_count() noexcept
+        {
+            const size_t hardwareThreads = std::thread::hardware_concurrency();
+            return hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+        }
+
+        template <typename Task>
+        static void invoke(void* task, size_t index)
+        {
+            (*static_cast<Task*>(task))(index);
+        }
+
+        static void execute(job& current) noexcept
+        {
+            for (auto index = current.next.fetch_add(1, std::memory_order_relaxed);
+                 index < current.count;
+                 index = current.next.fetch_add(1, std::memory_order_relaxed))
+            {
+                current.invoke(current.task, index);
+            }
+        }
+
+        bool spawn_worker() noexcept
+        {
+#if EXL_EXCEPTIONS
+            try
+            {
+                workers_.emplace_back(&thread_pool::work, this);
+            }
+            catch (...)
+            {
+                return false;
+            }
+#else
+            workers_.emplace_back(&thread_pool::work, this);
+#endif
+            return true;
+        }
+
+        void work() noexcept
+        {
+            uint64_t seenGeneration = 0;
+
+            std::unique_lock<std::mutex> lock(mutex_);
+            for (;;)
+            {
+                wakeCondition_.wait(lock, [this, seenGeneration]()
+                {
+                    return stop_ || (job_ != nullptr && generation_ != seenGeneration);
+                });
+
+                if (stop_)
+                {
+                    return;
+                }
+
+                seenGeneration = generation_;
+                job* current = job_;
+                ++active_;
+
+                lock.unlock();
+                execute(*current);
+                lock.lock();
+
+                if (--active_ == 0)
+                {
+                    doneCondition_.notify_one();
+                }
+            }
+        }
+
+    private:
+        std::vector<std::thread> workers_;
+
+        std::mutex runMutex_;
+        std::mutex mutex_;
+        std::condition_variable wakeCondition_;
+        std::condition_variable doneCondition_;
+
+        job* job_ = nullptr;
+        uint64_t generation_ = 0;
+        size_t active_ = 0;
+        bool stop_ = false;
+    };
+}
@@ -0,0 +1,218 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <exl/arena.hpp>
+#include <exl/option.hpp>
+
+#include <ClassMock.hpp>
+
+using namespace exl::test;
+
+namespace
+{
+    bool is_aligned(const void* ptr, size_t alignment)
+    {
+        return reinterpret_cast<uintptr_t>(ptr) % alignment == 0;
+    }
+
+    struct alignas(64) Overaligned
+    {
+        char data[3];
+    };
+
+    struct Base
+    {
+        virtual ~Base() = default;
+    };
+
+    struct Derived : Base
+    {
+        explicit Derived(int* destroyed) : destroyed_(destroyed) {}
+        ~Derived() override { ++*destroyed_; }
+
+        int* destroyed_;
+    };
+}
+
+TEST_CASE("exl::arena make test", "[arena]")
+{
+    exl::arena arena;
+
+    SECTION("Constructs value by forwarding")
+    {
+        auto value = arena.make<std::string>(3, 'x');
+
+        REQUIRE(value.is_valid());
+        REQUIRE(*value == "xxx");
+    }
+
+    SECTION("Box destroys value")
+    {
+        CallCounter calls;
+        {
+            auto value = arena.make<ClassMock>(1, &calls);
+            REQUIRE(value->tag() == 1);
+        }
+
+        REQUIRE(calls.count(CallType::Destroy, 1) == 1);
+    }
+
+    SECTION("Box has size of pointer")
+    {
+        REQUIRE(sizeof(exl::arena_box<std::string>) == sizeof(std::string*));
+        REQUIRE(sizeof(exl::option<exl::arena_box<std::string>>) == sizeof(std::string*));
+    }
+
+    SECTION("Values are aligned")
+    {
+        auto byte = arena.make<char>('a');
+        auto number = arena.make<uint64_t>(uint64_t(1));
+        auto overaligned = arena.make<Overaligned>();
+
+        REQUIRE(is_aligned(&*number, alignof(uint64_t)));
+        REQUIRE(is_aligned(&*overaligned, 64));
+    }
+
+    SECTION("Derived box is assigned to base box")
+    {
+        int destroyed = 0;
+        {
+            auto base = exl::arena_box<Base>(nullptr);
+            base = arena.make<Derived>(&destroyed);
+            REQUIRE(base.is_valid());
+        }
+
+        REQUIRE(destroyed == 1);
+    }
+}
+
+TEST_CASE("exl::arena growth test", "[arena]")
+{
+    exl::arena arena(64);
+
+    std::vector<exl::arena_box<uint64_t>> values;
+    for (uint64_t i = 0; i < 1000; ++i)
+    {
+        values.push_back(arena.make<uint64_t>(i));
+    }
+
+    for (uint64_t i = 0; i < 1000; ++i)
+    {
+        REQUIRE(values[i].is_valid());
+        REQUIRE(*values[i] == i);
+    }
+
+    SECTION("Allocation larger than the block")
+    {
+        void* memory = arena.allocate(100000, 8);
+        REQUIRE(memory != nullptr);
+    }
+}
+
+TEST_CASE("exl::arena huge allocation test", "[arena]")
+{
+    SECTION("Growing arena rejects the sizes which overflow")
+    {
+        exl::arena arena(64);
+
+        REQUIRE(arena.allocate(SIZE_MAX / 2 + 2, 8) == nullptr);
+        REQUIRE(arena.allocate(SIZE_MAX, 8) == nullptr);
+        REQUIRE(arena.allocate(SIZE_MAX - 16, 4096) == nullptr);
+    }
+
+    SECTION("Failed request doesn't change the next block size")
+    {
+        exl::arena arena(64);
+
+        REQUIRE(arena.allocate(SIZE_MAX / 2 + 2, 8) == nullptr);
+        REQUIRE(arena.allocate(8, 8) != nullptr);
+        REQUIRE(arena.available() == 56);
+    }
+
+    SECTION("Fixed arena rejects the sizes which overflow with padding")
+    {
+        alignas(8) char buffer[32];
+        exl::arena arena(buffer, sizeof(buffer));
+
+        REQUIRE(arena.allocate(1, 1) != nullptr);
+        REQUIRE(arena.allocate(SIZE_MAX, 2) == nullptr);
+        REQUIRE(arena.allocate(SIZE_MAX - 6, 8) == nullptr);
+        REQUIRE(arena.available() == 31);
+    }
+}
+
+TEST_CASE("exl::arena reset test", "[arena]")
+{
+    SECTION("Growing arena reuses its largest block")
+    {
+        exl::arena arena(64);
+        for (int i = 0; i < 100; ++i)
+        {
+            arena.make<uint64_t>(uint64_t(i));
+        }
+
+        arena.reset();
+        const size_t available = arena.available();
+
+        // 800 bytes are allocated in the blocks of 64, 128, 256 and 512 bytes
+        REQUIRE(available == 512);
+
+        arena.make<uint64_t>(uint64_t(0));
+        REQUIRE(arena.available() == available - 8);
+    }
+
+    SECTION("Fixed arena is rewound to the buffer start")
+    {
+        alignas(8) char buffer[32];
+        exl::arena arena(buffer, sizeof(buffer));
+
+        void* first = arena.allocate(16, 8);
+        arena.allocate(16, 8);
+        arena.reset();
+
+        REQUIRE(arena.allocate(16, 8) == first);
+    }
+}
+
+TEST_CASE("exl::arena exhaustion test", "[arena]")
+{
+    alignas(8) char buffer[16];
+    exl::arena arena(buffer, sizeof(buffer));
+
+    auto first = arena.make<uint64_t>(uint64_t(1));
+    auto second = arena.make<uint64_t>(uint64_t(2));
+    REQUIRE(first.is_valid());
+    REQUIRE(second.is_valid());
+
+    SECTION("Invalid box")
+    {
+        auto value = arena.make<uint64_t>(uint64_t(3));
+        REQUIRE(!value.is_valid());
+    }
+
+    SECTION("Error")
+    {
+        auto value = arena.try_make<uint64_t>(uint64_t(3));
+        REQUIRE(value.is_error<exl::arena_exhausted>());
+    }
+
+    SECTION("Value")
+    {
+        first = exl::arena_box<uint64_t>(nullptr);
+        second = exl::arena_box<uint64_t>(nullptr);
+        arena.reset();
+
+        auto value = arena.try_make<uint64_t>(uint64_t(3));
+        REQUIRE(value.is_ok());
+        REQUIRE(*value.unwrap_ok() == 3);
+    }
+}
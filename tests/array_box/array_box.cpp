@@ -0,0 +1,345 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include <catch2/catch.hpp>
+
+#include <exl/array_box.hpp>
+#include <exl/option.hpp>
+#include <exl/relocate.hpp>
+
+#include <ClassMock.hpp>
+
+using namespace exl::test;
+
+namespace
+{
+    /// @brief Owning pointer with the non-trivial move, which is trivially relocatable
+    struct Handle
+    {
+        Handle() noexcept
+                : value(nullptr) {}
+
+        Handle(Handle&& rhs) noexcept
+                : value(rhs.value)
+        {
+            rhs.value = nullptr;
+        }
+
+        ~Handle()
+        {
+            delete value;
+        }
+
+        uint32_t* value;
+    };
+}
+
+namespace exl
+{
+    template <>
+    struct is_trivially_relocatable<Handle>
+    {
+        static constexpr bool value() { return true; }
+    };
+}
+
+TEST_CASE("exl::array_box make test", "[array_box]")
+{
+    SECTION("Default array box is invalid")
+    {
+        exl::array_box<uint32_t> values;
+
+        REQUIRE(!values.is_valid());
+        REQUIRE(values.size() == 0);
+    }
+
+    SECTION("Trivial elements are zeroed")
+    {
+        auto values = exl::array_box<uint32_t>::make(16);
+
+        REQUIRE(values.is_valid());
+        REQUIRE(values.size() == 16);
+        for (uint32_t value : values)
+        {
+            REQUIRE(value == 0);
+        }
+    }
+
+    SECTION("Non-trivial elements are value-initialized")
+    {
+        auto values = exl::array_box<std::string>::make(3);
+
+        REQUIRE(values.size() == 3);
+        REQUIRE(values[2].empty());
+    }
+
+    SECTION("For overwrite")
+    {
+        auto values = exl::array_box<uint8_t>::make_for_overwrite(64);
+
+        REQUIRE(values.is_valid());
+        REQUIRE(values.size() == 64);
+    }
+
+    SECTION("Filled")
+    {
+        auto values = exl::array_box<std::string>::make_filled(2, "exl");
+
+        REQUIRE(values.size() == 2);
+        REQUIRE(values[0] == "exl");
+        REQUIRE(values[1] == "exl");
+    }
+
+    SECTION("Copy of view")
+    {
+        const uint32_t source[] = { 1, 2, 3 };
+        auto values = exl::array_box<uint32_t>::make_copy(source);
+
+        REQUIRE(values.size() == 3);
+        REQUIRE(values.data() != source);
+        REQUIRE(values[2] == 3);
+    }
+
+    SECTION("Empty array is valid")
+    {
+        auto values = exl::array_box<uint32_t>::make(0);
+
+        REQUIRE(values.is_valid());
+        REQUIRE(values.empty());
+        REQUIRE(values.begin() == values.end());
+    }
+
+    SECTION("Copy of empty view")
+    {
+        auto values = exl::array_box<uint32_t>::make_copy(exl::array_view<const uint32_t>());
+
+        REQUIRE(values.is_valid());
+        REQUIRE(values.empty());
+    }
+
+    SECTION("Allocation failure")
+    {
+        auto values = exl::array_box<uint64_t>::make_for_overwrite(SIZE_MAX / 4);
+
+        REQUIRE(!values.is_valid());
+        REQUIRE(values.size() == 0);
+    }
+
+    SECTION("Option of array box has size of array box")
+    {
+        REQUIRE(sizeof(exl::option<exl::array_box<uint32_t>>) == sizeof(exl::array_box<uint32_t>));
+    }
+}
+
+TEST_CASE("exl::array_box ownership test", "[array_box]")
+{
+    CallCounter calls;
+    const ClassMock prototype(1, &calls);
+
+    SECTION("Elements are destroyed")
+    {
+        {
+            auto values = exl::array_box<ClassMock>::make_filled(3, prototype);
+        }
+
+        REQUIRE(calls.count(CallType::Copy, 1) == 3);
+        REQUIRE(calls.count(CallType::Destroy, as_copied_tag(1)) == 3);
+    }
+
+    SECTION("Move leaves source invalid")
+    {
+        auto values = exl::array_box<uint32_t>::make(4);
+        const uint32_t* data = values.data();
+
+        auto moved = std::move(values);
+
+        REQUIRE(!values.is_valid());
+        REQUIRE(values.size() == 0);
+        REQUIRE(moved.data() == data);
+        REQUIRE(moved.size() == 4);
+    }
+
+    SECTION("Move assignment destroys previous elements")
+    {
+        auto values = exl::array_box<ClassMock>::make_filled(2, prototype);
+        values = exl::array_box<ClassMock>::make(1);
+
+        REQUIRE(calls.count(CallType::Destroy, as_copied_tag(1)) == 2);
+        REQUIRE(values.size() == 1);
+    }
+
+    SECTION("Swap")
+    {
+        auto lhs = exl::array_box<uint32_t>::make(1);
+        auto rhs = exl::array_box<uint32_t>::make(2);
+
+        std::swap(lhs, rhs);
+
+        REQUIRE(lhs.size() == 2);
+        REQUIRE(rhs.size() == 1);
+    }
+}
+
+TEST_CASE("exl::array_box bulk operations test", "[array_box]")
+{
+    auto values = exl::array_box<uint32_t>::make(4);
+
+    SECTION("Copy from view")
+    {
+        const uint32_t source[] = { 7, 8 };
+
+        REQUIRE(values.copy_from(source, 1));
+        REQUIRE(values[0] == 0);
+        REQUIRE(values[1] == 7);
+        REQUIRE(values[2] == 8);
+        REQUIRE(values[3] == 0);
+    }
+
+    SECTION("Copy which doesn't fit is rejected")
+    {
+        const uint32_t source[] = { 7, 8 };
+
+        REQUIRE(!values.copy_from(source, 3));
+        REQUIRE(!values.copy_from(source, 5));
+        REQUIRE(values[3] == 0);
+    }
+
+    SECTION("Copy of non-trivial elements")
+    {
+        auto strings = exl::array_box<std::string>::make(2);
+        const std::string source[] = { "exl" };
+
+        REQUIRE(strings.copy_from(source, 1));
+        REQUIRE(strings[0].empty());
+        REQUIRE(strings[1] == "exl");
+    }
+
+    SECTION("Fill with uniform bytes")
+    {
+        values.fill(0x01010101);
+
+        for (uint32_t value : values)
+        {
+            REQUIRE(value == 0x01010101);
+        }
+    }
+
+    SECTION("Fill with non-uniform bytes")
+    {
+        values.fill(0x12345678);
+
+        for (uint32_t value : values)
+        {
+            REQUIRE(value == 0x12345678);
+        }
+    }
+
+    SECTION("Empty and invalid array boxes")
+    {
+        exl::array_box<uint32_t> invalid;
+        auto empty = exl::array_box<uint32_t>::make(0);
+
+        invalid.fill(0);
+        empty.fill(0x12345678);
+        REQUIRE(invalid.copy_from(exl::array_view<const uint32_t>()));
+        REQUIRE(empty.copy_from(values.view().subview(0, 0)));
+        REQUIRE(!invalid.is_valid());
+        REQUIRE(empty.empty());
+    }
+
+    SECTION("View of const array box")
+    {
+        const auto& constValues = values;
+        exl::array_view<const uint32_t> view = constValues.view();
+
+        REQUIRE(view.data() == values.data());
+        REQUIRE(view.size() == 4);
+    }
+}
+
+TEST_CASE("exl::array_box resize test", "[array_box]")
+{
+    SECTION("Grow keeps elements and value-initializes new ones")
+    {
+        auto values = exl::array_box<uint32_t>::make_filled(2, 5);
+
+        REQUIRE(values.resize(1000));
+        REQUIRE(values.size() == 1000);
+        REQUIRE(values[1] == 5);
+        REQUIRE(values[999] == 0);
+    }
+
+    SECTION("Shrink")
+    {
+        auto values = exl::array_box<uint32_t>::make_filled(1000, 5);
+
+        REQUIRE(values.resize(2));
+        REQUIRE(values.size() == 2);
+        REQUIRE(values[1] == 5);
+
+        REQUIRE(values.resize(0));
+        REQUIRE(values.is_valid());
+        REQUIRE(values.empty());
+    }
+
+    SECTION("Invalid array box is resized as empty one")
+    {
+        exl::array_box<uint32_t> values;
+
+        REQUIRE(values.resize(3));
+        REQUIRE(values.is_valid());
+        REQUIRE(values[2] == 0);
+    }
+
+    SECTION("Allocation failure keeps array unchanged")
+    {
+        auto values = exl::array_box<uint64_t>::make_filled(2, 5);
+        const uint64_t* data = values.data();
+
+        REQUIRE(!values.resize(SIZE_MAX / 4));
+        REQUIRE(values.data() == data);
+        REQUIRE(values.size() == 2);
+        REQUIRE(values[1] == 5);
+    }
+
+    SECTION("Non-trivially relocatable elements are moved")
+    {
+        CallCounter calls;
+        const ClassMock prototype(1, &calls);
+        auto values = exl::array_box<ClassMock>::make_filled(2, prototype);
+
+        REQUIRE(values.resize(3));
+        REQUIRE(calls.count(CallType::Move, as_copied_tag(1)) == 2);
+        REQUIRE(values[0].tag() == as_moved_tag(as_copied_tag(1)));
+        REQUIRE(values[2].tag() == 0);
+
+        REQUIRE(values.resize(1));
+        REQUIRE(values.size() == 1);
+    }
+
+    SECTION("Trivially relocatable elements are reallocated")
+    {
+        auto handles = exl::array_box<Handle>::make(1);
+        handles[0].value = new uint32_t(42);
+        const uint32_t* owned = handles[0].value;
+
+        REQUIRE(handles.resize(1000));
+        REQUIRE(handles[0].value == owned);
+        REQUIRE(handles[999].value == nullptr);
+    }
+
+    SECTION("Non-trivial elements")
+    {
+        auto values = exl::array_box<std::string>::make_filled(2, "exl");
+
+        REQUIRE(values.resize(64));
+        REQUIRE(values[1] == "exl");
+        REQUIRE(values[63].empty());
+    }
+}
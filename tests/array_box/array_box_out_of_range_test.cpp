@@ -0,0 +1,18 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstdint>
+
+#include <exl/array_box.hpp>
+
+#include <termination_test.hpp>
+
+void termination_test()
+{
+    auto values = exl::array_box<uint32_t>::make(4);
+    auto& outOfRange = values[4];
+
+    (void) outOfRange;
+}
@@ -0,0 +1,91 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstdint>
+#include <type_traits>
+
+#include <catch2/catch.hpp>
+
+#include <exl/array_view.hpp>
+
+TEST_CASE("exl::array_view construction test", "[array_view]")
+{
+    uint32_t values[] = { 1, 2, 3, 4 };
+
+    SECTION("Default view is empty")
+    {
+        exl::array_view<uint32_t> view;
+
+        REQUIRE(view.empty());
+        REQUIRE(view.data() == nullptr);
+    }
+
+    SECTION("From C array")
+    {
+        exl::array_view<uint32_t> view(values);
+
+        REQUIRE(view.data() == values);
+        REQUIRE(view.size() == 4);
+        REQUIRE(view.size_bytes() == sizeof(values));
+    }
+
+    SECTION("Const view from mutable view")
+    {
+        exl::array_view<uint32_t> view(values);
+        exl::array_view<const uint32_t> constView = view;
+
+        REQUIRE(constView.data() == values);
+        REQUIRE(constView.size() == 4);
+        REQUIRE(!std::is_convertible<
+                exl::array_view<const uint32_t>,
+                exl::array_view<uint32_t>
+        >::value);
+    }
+
+    SECTION("View has size of pointer and size")
+    {
+        REQUIRE(sizeof(exl::array_view<uint32_t>) == sizeof(uint32_t*) + sizeof(size_t));
+    }
+}
+
+TEST_CASE("exl::array_view access test", "[array_view]")
+{
+    uint32_t values[] = { 1, 2, 3, 4 };
+    exl::array_view<uint32_t> view(values);
+
+    SECTION("Index access")
+    {
+        view[2] = 30;
+
+        REQUIRE(view[0] == 1);
+        REQUIRE(values[2] == 30);
+    }
+
+    SECTION("Range iteration")
+    {
+        uint32_t sum = 0;
+        for (uint32_t value : view)
+        {
+            sum += value;
+        }
+
+        REQUIRE(sum == 10);
+    }
+
+    SECTION("Subview")
+    {
+        auto middle = view.subview(1, 2);
+
+        REQUIRE(middle.data() == values + 1);
+        REQUIRE(middle.size() == 2);
+    }
+
+    SECTION("Subview is clamped")
+    {
+        REQUIRE(view.subview(3, 10).size() == 1);
+        REQUIRE(view.subview(10, 1).empty());
+        REQUIRE(view.subview(10, 1).data() == values + 4);
+    }
+}
@@ -3,7 +3,9 @@
 // Distributed under the Boost Software License, Version 1.0.
 // (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
 
+#include <cstdint>
 #include <map>
+#include <utility>
 
 #include <catch2/catch.hpp>
 
@@ -12,6 +14,7 @@
 #include <ClassMock.hpp>
 #include <AllocObject.hpp>
 #include <deleter_function_stub.hpp>
+#include <StubAllocator.hpp>
 #include <StubDeleter.hpp>
 
 using namespace exl::test;
@@ -428,4 +431,206 @@ TEST_CASE("exl::box can be created as array with static size")
     REQUIRE(boxed[0] == 1);
     REQUIRE(boxed[1] == 2);
     REQUIRE(boxed[2] == 3);
-}
\ No newline at end of file
+}
+
+TEST_CASE("exl::box allocate_make allocates from the allocator", "[box]")
+{
+    StubArena arena;
+    CallCounter calls;
+
+    using Box = exl::allocator_box<ClassMock, StubAllocator<ClassMock>>;
+
+    {
+        auto boxed = Box::allocate_make(StubAllocator<ClassMock>(&arena), 1, &calls);
+
+        REQUIRE(boxed.is_valid());
+        REQUIRE(boxed->tag() == 1);
+        REQUIRE(arena.allocations == 1);
+        REQUIRE(arena.allocated == 1);
+    }
+
+    REQUIRE(calls.count(CallType::Destroy, 1) == 1);
+    REQUIRE(arena.deallocations == 1);
+    REQUIRE(arena.allocated == 0);
+}
+
+TEST_CASE("exl::box allocate_make returns invalid box on allocation failure", "[box]")
+{
+    StubArena arena;
+    arena.fail = true;
+
+    auto boxed = exl::allocator_box<int, StubAllocator<int>>::allocate_make(
+            StubAllocator<int>(&arena),
+            42
+    );
+
+    REQUIRE(!boxed.is_valid());
+    REQUIRE(arena.allocations == 0);
+}
+
+TEST_CASE("exl::box allocate_make_array allocates array from the allocator", "[box]")
+{
+    StubArena arena;
+
+    {
+        auto boxed = exl::allocator_box<int[], StubAllocator<int>>::allocate_make_array(
+                StubAllocator<int>(&arena),
+                3
+        );
+
+        REQUIRE(boxed.is_valid());
+        REQUIRE(arena.allocated == 3);
+
+        // Elements are value-initialized
+        REQUIRE(boxed[0] == 0);
+        REQUIRE(boxed[2] == 0);
+    }
+
+    REQUIRE(arena.deallocations == 1);
+    REQUIRE(arena.allocated == 0);
+}
+
+TEST_CASE("exl::box with stateful allocator keeps allocator on move and swap", "[box]")
+{
+    StubArena arena1;
+    StubArena arena2;
+
+    using Box = exl::allocator_box<int, StubAllocator<int>>;
+
+    {
+        auto boxed1 = Box::allocate_make(StubAllocator<int>(&arena1), 1);
+        auto boxed2 = Box::allocate_make(StubAllocator<int>(&arena2), 2);
+
+        std::swap(boxed1, boxed2);
+        REQUIRE(*boxed1 == 2);
+
+        auto boxed3 = std::move(boxed1);
+        boxed2 = std::move(boxed3);
+
+        // Value of the first arena is destroyed by the assignment
+        REQUIRE(arena1.deallocations == 1);
+        REQUIRE(arena2.deallocations == 0);
+        REQUIRE(*boxed2 == 2);
+    }
+
+    REQUIRE(arena1.allocated == 0);
+    REQUIRE(arena2.allocated == 0);
+}
+
+TEST_CASE("exl::box with stateless allocator has size of pointer", "[box]")
+{
+    using Box = exl::allocator_box<ClassMock, StubStatelessAllocator<ClassMock>>;
+    REQUIRE(sizeof(Box) == sizeof(ClassMock*));
+
+    CallCounter calls;
+    {
+        auto boxed = Box::allocate_make(StubStatelessAllocator<ClassMock>(), 1, &calls);
+        REQUIRE(boxed->tag() == 1);
+    }
+
+    REQUIRE(calls.count(CallType::Destroy, 1) == 1);
+
+    auto standard = exl::allocator_box<int, std::allocator<int>>::allocate_make(
+            std::allocator<int>(),
+            42
+    );
+    REQUIRE(sizeof(standard) == sizeof(int*));
+    REQUIRE(*standard == 42);
+}
+
+TEST_CASE("exl::box can be created as array for overwrite", "[box]")
+{
+    auto boxed = exl::box<int[]>::make_array_for_overwrite(3);
+    REQUIRE(boxed.is_valid());
+
+    boxed[2] = 3;
+    REQUIRE(boxed[2] == 3);
+}
+
+TEST_CASE("exl::box can be created as aligned array", "[box]")
+{
+    SECTION("Alignment is applied")
+    {
+        auto simd = exl::aligned_box<float[]>::make_array_aligned(16, 64);
+        auto page = exl::aligned_box<uint8_t[]>::make_array_aligned(8192, 4096);
+
+        REQUIRE(simd.is_valid());
+        REQUIRE(page.is_valid());
+        REQUIRE(reinterpret_cast<uintptr_t>(&simd[0]) % 64 == 0);
+        REQUIRE(reinterpret_cast<uintptr_t>(&page[0]) % 4096 == 0);
+
+        simd[15] = 1.0f;
+        page[8191] = 2;
+        REQUIRE(simd[15] == 1.0f);
+        REQUIRE(page[8191] == 2);
+    }
+
+    SECTION("Element alignment is kept for smaller alignments")
+    {
+        auto boxed = exl::aligned_box<uint64_t[]>::make_array_aligned(4, 1);
+        REQUIRE(reinterpret_cast<uintptr_t>(&boxed[0]) % alignof(uint64_t) == 0);
+    }
+
+    SECTION("Box has size of pointer")
+    {
+        REQUIRE(sizeof(exl::aligned_box<float[]>) == sizeof(float*));
+    }
+
+    SECTION("Invalid alignment")
+    {
+        auto boxed = exl::aligned_box<float[]>::make_array_aligned(16, 48);
+        REQUIRE(!boxed.is_valid());
+    }
+
+    SECTION("Size overflow")
+    {
+        auto boxed = exl::aligned_box<uint64_t[]>::make_array_aligned(SIZE_MAX / 4, 64);
+        REQUIRE(!boxed.is_valid());
+    }
+}
+
+TEST_CASE("exl::box can be created as huge page backed array", "[box]")
+{
+    SECTION("Array is aligned to the huge page")
+    {
+        const size_t size = 3 * 1024 * 1024 / sizeof(uint32_t);
+        auto table = exl::huge_page_box<uint32_t[]>::make_array_huge_pages(size);
+
+        REQUIRE(table.is_valid());
+        REQUIRE(reinterpret_cast<uintptr_t>(&table[0]) % (2 * 1024 * 1024) == 0);
+
+        table[0] = 1;
+        table[size - 1] = 2;
+        REQUIRE(table[0] == 1);
+        REQUIRE(table[size - 1] == 2);
+    }
+
+    SECTION("Size overflow")
+    {
+        auto table = exl::huge_page_box<uint64_t[]>::make_array_huge_pages(SIZE_MAX / 4);
+        REQUIRE(!table.is_valid());
+    }
+
+    SECTION("Empty array")
+    {
+        auto table = exl::huge_page_box<uint64_t[]>::make_array_huge_pages(0);
+        REQUIRE(!table.is_valid());
+    }
+}
+
+#if EXL_HAS_MEMORY_RESOURCE
+TEST_CASE("exl::pmr::box allocates from the memory resource", "[box]")
+{
+    char buffer[256];
+    std::pmr::monotonic_buffer_resource resource(buffer, sizeof(buffer));
+
+    auto boxed = exl::pmr::box<int>::allocate_make(
+            std::pmr::polymorphic_allocator<int>(&resource),
+            7
+    );
+
+    REQUIRE(*boxed == 7);
+    REQUIRE(static_cast<void*>(&*boxed) >= static_cast<void*>(buffer));
+    REQUIRE(static_cast<void*>(&*boxed) < static_cast<void*>(buffer + sizeof(buffer)));
+}
+#endif
@@ -0,0 +1,23 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+// Compile-fail test: exl::box::make and exl::box::make_array allocate with new, so the boxes
+// with the custom deleter should reject them. Test passes when compilation fails with the
+// static_assert message. Factory is selected with the EXL_TEST_MAKE_ARRAY definition.
+
+#include <memory>
+
+#include <exl/box.hpp>
+
+int main()
+{
+#if defined(EXL_TEST_MAKE_ARRAY)
+    auto boxed = exl::aligned_box<int[]>::make_array(3);
+#else
+    auto boxed = exl::allocator_box<int, std::allocator<int>>::make(1);
+#endif
+
+    return boxed.is_valid() ? 0 : 1;
+}
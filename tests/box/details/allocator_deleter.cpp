@@ -0,0 +1,102 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <memory>
+#include <type_traits>
+
+#include <catch2/catch.hpp>
+
+#include <exl/details/box/allocator_deleter.hpp>
+
+#include <StubAllocator.hpp>
+
+using namespace exl::test;
+
+TEST_CASE("exl::get_allocator_deleter selects deleter type", "[allocator_deleter]")
+{
+    SECTION("Stateless allocator of scalar")
+    {
+        using Deleter = exl::get_allocator_deleter<int, std::allocator<int>>::type;
+        REQUIRE(std::is_same<Deleter, exl::stateless_allocator_deleter<int, std::allocator<int>>>
+                ::value);
+        REQUIRE(std::is_empty<Deleter>::value);
+    }
+
+    SECTION("Stateful allocator of scalar")
+    {
+        using Deleter = exl::get_allocator_deleter<int, StubAllocator<char>>::type;
+        REQUIRE(std::is_same<
+                Deleter,
+                exl::deleter_object<int, exl::allocator_deleter<int, StubAllocator<char>>>
+        >::value);
+        REQUIRE(sizeof(Deleter) == sizeof(StubAllocator<int>));
+    }
+
+    SECTION("Array")
+    {
+        using Deleter = exl::get_allocator_deleter<int[], std::allocator<int>>::type;
+        REQUIRE(std::is_same<
+                Deleter,
+                exl::deleter_object<int[], exl::allocator_deleter<int[], std::allocator<int>>>
+        >::value);
+    }
+}
+
+TEST_CASE("exl::allocator_deleter returns memory to the allocator", "[allocator_deleter]")
+{
+    StubArena arena;
+
+    SECTION("Scalar")
+    {
+        StubAllocator<int> allocator(&arena);
+        int* value = allocator.allocate(1);
+
+        exl::allocator_deleter<int, StubAllocator<int>> deleter(allocator);
+        REQUIRE(deleter.get_allocator() == allocator);
+
+        deleter(value);
+        REQUIRE(arena.deallocations == 1);
+        REQUIRE(arena.allocated == 0);
+    }
+
+    SECTION("Array")
+    {
+        StubAllocator<int> allocator(&arena);
+        int* values = allocator.allocate(4);
+
+        exl::allocator_deleter<int[], StubAllocator<int>> deleter(allocator, 4);
+        REQUIRE(deleter.size() == 4);
+
+        deleter(values);
+        REQUIRE(arena.deallocations == 1);
+        REQUIRE(arena.allocated == 0);
+    }
+
+    SECTION("Move assigned")
+    {
+        StubArena otherArena;
+        StubAllocator<int> allocator(&arena);
+        int* value = allocator.allocate(1);
+
+        StubAllocator<int> otherAllocator(&otherArena);
+
+        exl::allocator_deleter<int, StubAllocator<int>> deleter(otherAllocator);
+        deleter = exl::allocator_deleter<int, StubAllocator<int>>(allocator);
+
+        deleter(value);
+        REQUIRE(arena.deallocations == 1);
+        REQUIRE(otherArena.deallocations == 0);
+    }
+}
+
+TEST_CASE("exl::allocator_deleter relocation test", "[allocator_deleter]")
+{
+    REQUIRE(exl::is_trivially_relocatable<
+            exl::allocator_deleter<int, StubAllocator<int>>
+    >::value());
+    REQUIRE(exl::is_trivially_relocatable<
+            exl::get_allocator_deleter<int[], StubAllocator<int>>::type
+    >::value());
+}
@@ -0,0 +1,40 @@
+# Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+#
+# Distributed under the Boost Software License, Version 1.0.
+# (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+# Checks x86-64 SysV assembly (AT&T syntax) produced from register_return.cpp.
+# Value returned through memory is written via hidden pointer passed in %rdi.
+#
+# Usage: cmake -DASM_FILE=<path> -P check_register_return.cmake
+
+file(STRINGS "${ASM_FILE}" ASM_LINES)
+
+set(CURRENT_FUNCTION "")
+set(CHECKED_FUNCTIONS 0)
+
+foreach(LINE IN LISTS ASM_LINES)
+    if (LINE MATCHES "^([A-Za-z0-9_]*exl_codegen_(register|memory)_[A-Za-z0-9_]*):")
+        set(CURRENT_FUNCTION "${CMAKE_MATCH_1}")
+        set(CURRENT_KIND "${CMAKE_MATCH_2}")
+        set(USES_MEMORY_RETURN FALSE)
+        math(EXPR CHECKED_FUNCTIONS "${CHECKED_FUNCTIONS} + 1")
+    elseif (NOT CURRENT_FUNCTION STREQUAL "")
+        if (LINE MATCHES "\\(%rdi\\)")
+            set(USES_MEMORY_RETURN TRUE)
+        elseif (LINE MATCHES "\\.cfi_endproc")
+            if (CURRENT_KIND STREQUAL "register" AND USES_MEMORY_RETURN)
+                message(FATAL_ERROR "${CURRENT_FUNCTION} returns value through memory")
+            elseif (CURRENT_KIND STREQUAL "memory" AND NOT USES_MEMORY_RETURN)
+                message(FATAL_ERROR "${CURRENT_FUNCTION} was expected to return through memory")
+            endif ()
+            set(CURRENT_FUNCTION "")
+        endif ()
+    endif ()
+endforeach()
+
+if (CHECKED_FUNCTIONS EQUAL 0)
+    message(FATAL_ERROR "No functions were found in ${ASM_FILE}")
+endif ()
+
+message(STATUS "Checked ${CHECKED_FUNCTIONS} functions")
@@ -0,0 +1,53 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+// Compiled to assembly and checked by check_register_return.cmake. Functions with
+// exl_codegen_register_ prefix should return the value in registers, functions with
+// exl_codegen_memory_ prefix are control group which should return the value through memory.
+
+#include <array>
+#include <cstdint>
+#include <system_error>
+
+#include <exl/mixed.hpp>
+#include <exl/option.hpp>
+
+using Small = exl::mixed<uint32_t, std::errc>;
+using Large = exl::mixed<std::array<uint64_t, 3>, std::errc>;
+
+exl::option<uint64_t> exl_codegen_register_option_some(uint64_t value);
+exl::option<uint64_t> exl_codegen_register_option_some(uint64_t value)
+{
+    return value;
+}
+
+exl::option<uint64_t> exl_codegen_register_option_none();
+exl::option<uint64_t> exl_codegen_register_option_none()
+{
+    return exl::none();
+}
+
+Small exl_codegen_register_mixed_error(bool failed);
+Small exl_codegen_register_mixed_error(bool failed)
+{
+    if (failed)
+    {
+        return std::errc::invalid_argument;
+    }
+
+    return uint32_t(42);
+}
+
+Small exl_codegen_register_mixed_copy(Small value);
+Small exl_codegen_register_mixed_copy(Small value)
+{
+    return value;
+}
+
+Large exl_codegen_memory_mixed_copy(const Large& value);
+Large exl_codegen_memory_mixed_copy(const Large& value)
+{
+    return value;
+}
@@ -0,0 +1,188 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <stdexcept>
+#include <string>
+
+#include <catch2/catch.hpp>
+
+#include <exl/match.hpp>
+#include <exl/option.hpp>
+
+namespace
+{
+    struct Idle {};
+    struct Running { int progress; };
+
+    struct Start {};
+    struct Stop {};
+    struct Tick { int delta; };
+
+    using State = exl::mixed<Idle, Running>;
+    using Event = exl::mixed<Start, Stop, Tick>;
+
+    State transition(const State& state, const Event& event)
+    {
+        return exl::map<State>(
+                state,
+                event,
+                exl::when_all_exact<Idle, Start>([](const Idle&, const Start&)
+                {
+                    return State(Running { 0 });
+                }),
+                exl::when_all_exact<Running, Tick>([](const Running& running, const Tick& tick)
+                {
+                    return State(Running { running.progress + tick.delta });
+                }),
+                exl::when_all_exact<Running, Stop>([](const Running&, const Stop&)
+                {
+                    return State(Idle {});
+                }),
+                exl::otherwise([&state]()
+                {
+                    return state;
+                })
+        );
+    }
+}
+
+TEST_CASE("Match of two mixed values test", "[match]")
+{
+    State state = Idle {};
+
+    SECTION("Transitions")
+    {
+        state = transition(state, Tick { 1 });
+        REQUIRE(state.is<Idle>());
+
+        state = transition(state, Start {});
+        REQUIRE(state.is<Running>());
+        REQUIRE(state.unwrap<Running>().progress == 0);
+
+        state = transition(state, Tick { 5 });
+        state = transition(state, Tick { 2 });
+        REQUIRE(state.unwrap<Running>().progress == 7);
+
+        state = transition(state, Start {});
+        REQUIRE(state.unwrap<Running>().progress == 7);
+
+        state = transition(state, Stop {});
+        REQUIRE(state.is<Idle>());
+    }
+}
+
+TEST_CASE("Match with derived types test", "[match]")
+{
+    using Lhs = exl::mixed<int, std::runtime_error, std::logic_error>;
+    using Rhs = exl::mixed<std::string, std::invalid_argument>;
+
+    int result = 0;
+
+    auto do_match = [&result](const Lhs& lhs, const Rhs& rhs)
+    {
+        exl::match(
+                lhs,
+                rhs,
+                exl::when_all_exact<int, std::string>([&result](const int& l, const std::string& r)
+                {
+                    result = l + static_cast<int>(r.size());
+                }),
+                // std::invalid_argument is derived from std::logic_error
+                exl::when_all<std::logic_error, std::logic_error>(
+                        [&result](const std::logic_error&, const std::logic_error&)
+                        {
+                            result = 2;
+                        }
+                ),
+                exl::when_all<std::exception, std::string>(
+                        [&result](const std::exception& e, const std::string&)
+                        {
+                            result = std::string(e.what()) == "runtime" ? 3 : 4;
+                        }
+                ),
+                exl::otherwise([&result]()
+                {
+                    result = 42;
+                })
+        );
+    };
+
+    SECTION("Exact types")
+    {
+        do_match(Lhs(1), Rhs(std::string("abc")));
+        REQUIRE(result == 4);
+    }
+
+    SECTION("Derived types")
+    {
+        do_match(Lhs(std::logic_error("logic")), Rhs(std::invalid_argument("invalid")));
+        REQUIRE(result == 2);
+
+        do_match(Lhs(std::runtime_error("runtime")), Rhs(std::string()));
+        REQUIRE(result == 3);
+
+        do_match(Lhs(std::logic_error("logic")), Rhs(std::string()));
+        REQUIRE(result == 4);
+    }
+
+    SECTION("Otherwise")
+    {
+        do_match(Lhs(1), Rhs(std::invalid_argument("invalid")));
+        REQUIRE(result == 42);
+
+        do_match(Lhs(std::runtime_error("runtime")), Rhs(std::invalid_argument("invalid")));
+        REQUIRE(result == 42);
+    }
+}
+
+TEST_CASE("Match of three values and options test", "[match]")
+{
+    using Mixed = exl::mixed<char, int>;
+
+    auto sum = [](const exl::option<int>& a, const exl::option<int>& b, const Mixed& c)
+    {
+        return exl::map<int>(
+                a,
+                b,
+                c,
+                exl::when_all_exact<int, int, int>([](const int& x, const int& y, const int& z)
+                {
+                    return x + y + z;
+                }),
+                exl::when_all_exact<int, int, char>([](const int& x, const int& y, const char&)
+                {
+                    return x + y;
+                }),
+                exl::otherwise([]()
+                {
+                    return -1;
+                })
+        );
+    };
+
+    REQUIRE(sum(1, 2, Mixed(3)) == 6);
+    REQUIRE(sum(1, 2, Mixed('c')) == 3);
+    REQUIRE(sum(1, exl::none(), Mixed(3)) == -1);
+    REQUIRE(sum(exl::none(), exl::none(), Mixed('c')) == -1);
+}
+
+TEST_CASE("Match of single value test", "[match]")
+{
+    exl::mixed<int, std::string> value(std::string("hello"));
+
+    auto size = exl::map<size_t>(
+            value,
+            exl::when_all_exact<std::string>([](const std::string& str)
+            {
+                return str.size();
+            }),
+            exl::when_all_exact<int>([](const int&)
+            {
+                return size_t(0);
+            })
+    );
+
+    REQUIRE(size == 5);
+}
@@ -0,0 +1,254 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <array>
+#include <cstdint>
+#include <forward_list>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <exl/inline_budget.hpp>
+#include <exl/match_batch.hpp>
+#include <exl/option.hpp>
+
+namespace
+{
+    using Mixed = exl::mixed<int, char, std::string>;
+
+    std::vector<Mixed> make_values()
+    {
+        std::vector<Mixed> values;
+        values.emplace_back(1);
+        values.emplace_back(std::string("a"));
+        values.emplace_back('x');
+        values.emplace_back(2);
+        values.emplace_back(std::string("bc"));
+        values.emplace_back(3);
+        return values;
+    }
+}
+
+TEST_CASE("Batch match test", "[match_batch]")
+{
+    const auto values = make_values();
+
+    SECTION("Values are grouped by type in range order")
+    {
+        std::vector<int> ints;
+        std::vector<std::string> strings;
+        std::string visits;
+
+        exl::match_batch(
+                values.begin(),
+                values.end(),
+                exl::when<int>([&](const int& value)
+                {
+                    ints.push_back(value);
+                    visits += 'i';
+                }),
+                exl::when<char>([&](const char&)
+                {
+                    visits += 'c';
+                }),
+                exl::when<std::string>([&](const std::string& value)
+                {
+                    strings.push_back(value);
+                    visits += 's';
+                })
+        );
+
+        REQUIRE(ints == std::vector<int> { 1, 2, 3 });
+        REQUIRE(strings == std::vector<std::string> { "a", "bc" });
+
+        // Values of the same type are visited together
+        REQUIRE(visits.size() == 6);
+        REQUIRE(visits.find("iii") != std::string::npos);
+        REQUIRE(visits.find("ss") != std::string::npos);
+    }
+
+    SECTION("Otherwise")
+    {
+        int sum = 0;
+        size_t others = 0;
+
+        exl::match_batch(
+                values.begin(),
+                values.end(),
+                exl::when<int>([&sum](const int& value) { sum += value; }),
+                exl::otherwise([&others]() { ++others; })
+        );
+
+        REQUIRE(sum == 6);
+        REQUIRE(others == 3);
+    }
+
+    SECTION("Empty range")
+    {
+        size_t calls = 0;
+
+        exl::match_batch(
+                values.begin(),
+                values.begin(),
+                exl::otherwise([&calls]() { ++calls; })
+        );
+
+        REQUIRE(calls == 0);
+    }
+}
+
+TEST_CASE("Batch match of mutable range test", "[match_batch]")
+{
+    auto values = make_values();
+
+    exl::match_batch(
+            values.begin(),
+            values.end(),
+            exl::when<int>([](int& value) { value *= 10; }),
+            exl::when<std::string>([](std::string& value) { value += "!"; }),
+            exl::otherwise([]() {})
+    );
+
+    REQUIRE(values[0].unwrap<int>() == 10);
+    REQUIRE(values[1].unwrap<std::string>() == "a!");
+    REQUIRE(values[2].unwrap<char>() == 'x');
+    REQUIRE(values[3].unwrap<int>() == 20);
+    REQUIRE(values[4].unwrap<std::string>() == "bc!");
+    REQUIRE(values[5].unwrap<int>() == 30);
+}
+
+TEST_CASE("Batch match of derived types test", "[match_batch]")
+{
+    SECTION("Options in the forward list")
+    {
+        std::forward_list<exl::option<int>> values { 1, exl::none(), 2, exl::none(), 3 };
+
+        int sum = 0;
+        size_t nones = 0;
+
+        exl::match_batch(
+                values.cbegin(),
+                values.cend(),
+                exl::when<int>([&sum](const int& value) { sum += value; }),
+                exl::when<exl::none>([&nones](const exl::none&) { ++nones; })
+        );
+
+        REQUIRE(sum == 6);
+        REQUIRE(nones == 2);
+    }
+
+    SECTION("Matchers of base types")
+    {
+        using Error = exl::mixed<std::runtime_error, std::invalid_argument, int>;
+
+        std::array<Error, 3> errors {{
+                Error(std::runtime_error("runtime")),
+                Error(42),
+                Error(std::invalid_argument("invalid"))
+        }};
+
+        std::string messages;
+        exl::match_batch(
+                errors.begin(),
+                errors.end(),
+                exl::when<std::exception>([&messages](const std::exception& e)
+                {
+                    messages += e.what();
+                }),
+                exl::otherwise([]() {})
+        );
+
+        REQUIRE(messages.size() == std::string("runtimeinvalid").size());
+        REQUIRE(messages.find("runtime") != std::string::npos);
+        REQUIRE(messages.find("invalid") != std::string::npos);
+    }
+
+    SECTION("Out of line variants")
+    {
+        struct Bulk { std::array<uint8_t, 64> data; };
+        using Packet = exl::mixed<exl::inline_budget<8>, uint8_t, Bulk>;
+
+        Bulk bulk {};
+        bulk.data[0] = 7;
+
+        std::vector<Packet> packets;
+        packets.emplace_back(uint8_t(1));
+        packets.emplace_back(bulk);
+        packets.emplace_back(uint8_t(2));
+
+        std::vector<int> sizes(packets.size());
+        exl::map_batch<int>(
+                packets.begin(),
+                packets.end(),
+                sizes.begin(),
+                exl::when<uint8_t>([](const uint8_t& value) { return int(value); }),
+                exl::when<Bulk>([](const Bulk& value) { return 100 + value.data[0]; })
+        );
+
+        REQUIRE(sizes == std::vector<int> { 1, 107, 2 });
+    }
+}
+
+TEST_CASE("Batch map test", "[match_batch]")
+{
+    const auto values = make_values();
+
+    std::vector<std::string> results(values.size() + 1, "-");
+    auto last = exl::map_batch<std::string>(
+            values.begin(),
+            values.end(),
+            results.begin(),
+            exl::when<int>([](const int& value) { return std::to_string(value); }),
+            exl::when<std::string>([](const std::string& value) { return value; }),
+            exl::otherwise([]() { return std::string("?"); })
+    );
+
+    // Results are in the range order
+    REQUIRE(last == results.begin() + 6);
+    REQUIRE(results == std::vector<std::string> { "1", "a", "?", "2", "bc", "3", "-" });
+}
+
+TEST_CASE("Batch map of multiple blocks test", "[match_batch]")
+{
+    // Range is larger than the single block of exl::map_batch
+    std::vector<exl::mixed<int, char>> values;
+    std::vector<int> expected;
+    for (int i = 0; i < 1000; ++i)
+    {
+        if (i % 3 == 0)
+        {
+            values.emplace_back(char(i % 128));
+            expected.push_back(-(i % 128));
+        }
+        else
+        {
+            values.emplace_back(i);
+            expected.push_back(i);
+        }
+    }
+
+    std::vector<int> results(values.size());
+    exl::map_batch<int>(
+            values.begin(),
+            values.end(),
+            results.begin(),
+            exl::when<int>([](const int& value) { return value; }),
+            exl::when<char>([](const char& value) { return -int(value); })
+    );
+
+    REQUIRE(results == expected);
+
+    size_t chars = 0;
+    exl::match_batch(
+            values.begin(),
+            values.end(),
+            exl::when<char>([&chars](const char&) { ++chars; }),
+            exl::otherwise([]() {})
+    );
+
+    REQUIRE(chars == 334);
+}
@@ -81,6 +81,28 @@ TEST_CASE("Matcher exl::when can be called with any callable", "[matchers]")
     }
 }
 
+TEST_CASE("Matchers do not copy callables", "[matchers]")
+{
+    SECTION("Lvalue callable is stored by reference")
+    {
+        CallableMock callable;
+        auto matcher = exl::when<int>(callable);
+
+        REQUIRE(&matcher.impl == &callable);
+    }
+
+    SECTION("Rvalue callable is moved")
+    {
+        auto when = exl::when<int>(CallableMock());
+        auto whenExact = exl::when_exact<int>(CallableMock());
+        auto otherwise = exl::otherwise(CallableMock());
+
+        REQUIRE((when.impl.is_moved && !when.impl.is_copied));
+        REQUIRE((whenExact.impl.is_moved && !whenExact.impl.is_copied));
+        REQUIRE((otherwise.impl.is_moved && !otherwise.impl.is_copied));
+    }
+}
+
 TEST_CASE("Matcher exl::when result matcher has correct properties", "[matchers]")
 {
     auto matcher = exl::when<int>(&square);
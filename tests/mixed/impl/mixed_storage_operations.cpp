@@ -0,0 +1,156 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <string>
+#include <type_traits>
+
+#include <catch2/catch.hpp>
+
+#include <exl/impl/mixed/mixed_storage_operations.hpp>
+
+#include <ClassMock.hpp>
+
+using namespace exl::impl;
+using namespace exl::test;
+
+namespace
+{
+    using TL = type_list<int, ClassMock, char, std::string, double>;
+    using Storage = std::aligned_storage<
+            type_list_get_max_sizeof<TL>::value(),
+            type_list_get_max_alignof<TL>::value()
+    >::type;
+    using ChainOperations = mixed_storage_operations_chain<TL, Storage>;
+    using TableOperations = mixed_storage_operations_table<TL, Storage>;
+
+    constexpr type_list_tag_t MOCK_TAG = type_list_get_type_id<TL, ClassMock>::value();
+    constexpr type_list_tag_t STRING_TAG = type_list_get_type_id<TL, std::string>::value();
+}
+
+template <typename Operations>
+void test_storage_operations_dispatch()
+{
+    CallCounter calls;
+    Storage src;
+    Storage dest;
+
+    new(&src) ClassMock(1, &calls);
+
+    SECTION("Destroy")
+    {
+        Operations::destroy(src, MOCK_TAG);
+        REQUIRE(calls.count(CallType::Destroy, 1) == 1);
+    }
+
+    SECTION("Copy construct")
+    {
+        Operations::copy_construct_from(dest, src, MOCK_TAG);
+        REQUIRE(calls.count(CallType::Copy, 1) == 1);
+        REQUIRE(reinterpret_cast<ClassMock&>(dest).tag() == as_copied_tag(1));
+
+        Operations::destroy(dest, MOCK_TAG);
+        Operations::destroy(src, MOCK_TAG);
+    }
+
+    SECTION("Move construct")
+    {
+        Operations::move_construct_from(dest, std::move(src), MOCK_TAG);
+        REQUIRE(calls.count(CallType::Move, 1) == 1);
+        REQUIRE(reinterpret_cast<ClassMock&>(dest).tag() == as_moved_tag(1));
+
+        Operations::destroy(dest, MOCK_TAG);
+        Operations::destroy(src, MOCK_TAG);
+    }
+
+    SECTION("Copy assign")
+    {
+        new(&dest) ClassMock(2, &calls);
+
+        Operations::copy_assign_from(dest, src, MOCK_TAG);
+        REQUIRE(calls.count(CallType::Assign, 2) == 1);
+        REQUIRE(calls.count(CallType::Copy, 1) == 1);
+        REQUIRE(reinterpret_cast<ClassMock&>(dest).tag() == as_copied_tag(1));
+
+        Operations::destroy(dest, MOCK_TAG);
+        Operations::destroy(src, MOCK_TAG);
+    }
+
+    SECTION("Move assign")
+    {
+        new(&dest) ClassMock(2, &calls);
+
+        Operations::move_assign_from(dest, std::move(src), MOCK_TAG);
+        REQUIRE(calls.count(CallType::Assign, 2) == 1);
+        REQUIRE(calls.count(CallType::Move, 1) == 1);
+        REQUIRE(reinterpret_cast<ClassMock&>(dest).tag() == as_moved_tag(1));
+
+        Operations::destroy(dest, MOCK_TAG);
+        Operations::destroy(src, MOCK_TAG);
+    }
+}
+
+template <typename Operations>
+void test_storage_operations_select_type_by_tag()
+{
+    Storage src;
+    Storage dest;
+
+    new(&src) std::string("hello");
+
+    Operations::copy_construct_from(dest, src, STRING_TAG);
+    REQUIRE(reinterpret_cast<std::string&>(dest) == "hello");
+
+    Operations::destroy(dest, STRING_TAG);
+    Operations::destroy(src, STRING_TAG);
+}
+
+template <typename Operations>
+void test_storage_operations_swap()
+{
+    Storage lhs;
+    Storage rhs;
+
+    new(&lhs) std::string("hello");
+    new(&rhs) std::string("world");
+
+    Operations::swap(lhs, rhs, STRING_TAG);
+    REQUIRE(reinterpret_cast<std::string&>(lhs) == "world");
+    REQUIRE(reinterpret_cast<std::string&>(rhs) == "hello");
+
+    Operations::destroy(lhs, STRING_TAG);
+    Operations::destroy(rhs, STRING_TAG);
+}
+
+TEST_CASE("Mixed storage operations chain dispatch test", "[mixed_storage_operations]")
+{
+    test_storage_operations_dispatch<ChainOperations>();
+    test_storage_operations_select_type_by_tag<ChainOperations>();
+    test_storage_operations_swap<ChainOperations>();
+}
+
+TEST_CASE("Mixed storage operations table dispatch test", "[mixed_storage_operations]")
+{
+    test_storage_operations_dispatch<TableOperations>();
+    test_storage_operations_select_type_by_tag<TableOperations>();
+    test_storage_operations_swap<TableOperations>();
+}
+
+TEST_CASE("Mixed storage operations implementation selection test", "[mixed_storage_operations]")
+{
+    using SmallTL = type_list<int, char>;
+    using LargeTL = type_list<
+            int8_t, int16_t, int32_t, int64_t, uint8_t, uint16_t, uint32_t, uint64_t, float
+    >;
+
+    REQUIRE(std::is_same<
+            mixed_storage_operations<SmallTL, Storage>,
+            mixed_storage_operations_chain<SmallTL, Storage>
+    >::value);
+
+    REQUIRE(std::is_same<
+            mixed_storage_operations<LargeTL, Storage>,
+            mixed_storage_operations_table<LargeTL, Storage>
+    >::value);
+}
@@ -141,6 +141,71 @@ TEST_CASE("Type list subset id mapping test", "[type_list]")
     }
 }
 
+TEST_CASE("Type list large subset id mapping test", "[type_list]")
+{
+    using TL = type_list<
+            float, int8_t, int16_t, int32_t, int64_t, uint8_t, uint16_t, uint32_t, uint64_t, double
+    >;
+    using SubsetTL = type_list<
+            double, uint64_t, uint32_t, uint16_t, uint8_t, int64_t, int32_t, int16_t, int8_t
+    >;
+
+    using Mapper = type_list_subset_id_mapping<TL, SubsetTL>;
+
+    REQUIRE(
+            Mapper::get(type_list_get_type_id<SubsetTL, double>::value())
+            == type_list_get_type_id<TL, double>::value()
+    );
+    REQUIRE(
+            Mapper::get(type_list_get_type_id<SubsetTL, uint16_t>::value())
+            == type_list_get_type_id<TL, uint16_t>::value()
+    );
+    REQUIRE(
+            Mapper::get(type_list_get_type_id<SubsetTL, int8_t>::value())
+            == type_list_get_type_id<TL, int8_t>::value()
+    );
+}
+
+TEST_CASE("Type list same list id mapping test", "[type_list]")
+{
+    using TL = type_list<std::string, int, char>;
+
+    REQUIRE(type_list_subset_id_mapping<TL, TL>::get(0) == 0);
+    REQUIRE(type_list_subset_id_mapping<TL, TL>::get(2) == 2);
+}
+
+TEST_CASE("Type list suffix test", "[type_list]")
+{
+    using TL = type_list<std::string, int, char, double>;
+
+    REQUIRE(type_list_is_suffix_of<type_list<>, TL>::value());
+    REQUIRE(type_list_is_suffix_of<type_list<double>, TL>::value());
+    REQUIRE(type_list_is_suffix_of<type_list<char, double>, TL>::value());
+    REQUIRE(type_list_is_suffix_of<TL, TL>::value());
+
+    REQUIRE(!type_list_is_suffix_of<type_list<std::string, int>, TL>::value());
+    REQUIRE(!type_list_is_suffix_of<type_list<double, char>, TL>::value());
+    REQUIRE(!type_list_is_suffix_of<type_list<int, double>, TL>::value());
+    REQUIRE(!type_list_is_suffix_of<type_list<float, std::string, int, char, double>, TL>::value());
+}
+
+TEST_CASE("Type list suffix id mapping test", "[type_list]")
+{
+    using TL = type_list<std::string, int, char, double>;
+    using SuffixTL = type_list<char, double>;
+
+    REQUIRE(
+            type_list_subset_id_mapping<TL, SuffixTL>::get(
+                    type_list_get_type_id<SuffixTL, char>::value()
+            ) == type_list_get_type_id<TL, char>::value()
+    );
+    REQUIRE(
+            type_list_subset_id_mapping<TL, SuffixTL>::get(
+                    type_list_get_type_id<SuffixTL, double>::value()
+            ) == type_list_get_type_id<TL, double>::value()
+    );
+}
+
 TEST_CASE("Type list push front adds type to the type list", "[type_list]")
 {
     using TL = type_list<int, char>;
@@ -279,6 +344,24 @@ TEST_CASE("Type list remove same or derived works as expected", "[type_list]")
     }
 }
 
+TEST_CASE("Type list all of test", "[type_list]")
+{
+    SECTION("Predicate is satisfied for all types")
+    {
+        REQUIRE(type_list_all_of<type_list<int, char, double>, std::is_scalar>::value());
+    }
+
+    SECTION("Predicate is not satisfied for some types")
+    {
+        REQUIRE(!type_list_all_of<type_list<int, std::string, char>, std::is_scalar>::value());
+    }
+
+    SECTION("Predicate is satisfied for empty type list")
+    {
+        REQUIRE(type_list_all_of<type_list<>, std::is_scalar>::value());
+    }
+}
+
 TEST_CASE("Type list id set type params test", "[type_list]")
 {
     using TypeListIdSet = type_list_id_set<42, 5, 22>;
@@ -492,4 +575,159 @@ TEST_CASE("Best match test", "[type_list]")
                 char
         >::value);
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("Type list derived id mask contains same and derived types", "[type_list]")
+{
+    using TL = type_list<
+            std::runtime_error,
+            char,
+            std::exception,
+            int,
+            std::logic_error,
+            std::invalid_argument
+    >;
+    using Mask = type_list_derived_id_mask<TL, std::exception>;
+
+    REQUIRE(Mask::contains(type_list_get_type_id<TL, std::runtime_error>::value()));
+    REQUIRE(!Mask::contains(type_list_get_type_id<TL, char>::value()));
+    REQUIRE(Mask::contains(type_list_get_type_id<TL, std::exception>::value()));
+    REQUIRE(!Mask::contains(type_list_get_type_id<TL, int>::value()));
+    REQUIRE(Mask::contains(type_list_get_type_id<TL, std::logic_error>::value()));
+    REQUIRE(Mask::contains(type_list_get_type_id<TL, std::invalid_argument>::value()));
+
+    using CharMask = type_list_derived_id_mask<TL, char>;
+    REQUIRE(CharMask::contains(type_list_get_type_id<TL, char>::value()));
+    REQUIRE(!CharMask::contains(type_list_get_type_id<TL, int>::value()));
+}
+
+namespace
+{
+    struct MaskBase {};
+    struct MaskUnrelated {};
+
+    // Every third alternative is derived from MaskBase
+    template <int N>
+    struct MaskAlternative : std::conditional<N % 3 == 0, MaskBase, MaskUnrelated>::type {};
+
+    template <int N, typename ... Types>
+    struct make_mask_type_list
+    {
+        using type = typename make_mask_type_list<N - 1, MaskAlternative<N - 1>, Types...>::type;
+    };
+
+    template <typename ... Types>
+    struct make_mask_type_list<0, Types...>
+    {
+        using type = type_list<Types...>;
+    };
+}
+
+TEST_CASE("Type list derived id mask works for more than 64 types", "[type_list]")
+{
+    using TL = make_mask_type_list<100>::type;
+    using Mask = type_list_derived_id_mask<TL, MaskBase>;
+
+    REQUIRE(type_list_get_size<TL>::value() == 100);
+
+    REQUIRE(Mask::contains(type_list_get_type_id<TL, MaskAlternative<0>>::value()));
+    REQUIRE(!Mask::contains(type_list_get_type_id<TL, MaskAlternative<1>>::value()));
+    REQUIRE(Mask::contains(type_list_get_type_id<TL, MaskAlternative<30>>::value()));
+    REQUIRE(!Mask::contains(type_list_get_type_id<TL, MaskAlternative<35>>::value()));
+    REQUIRE(Mask::contains(type_list_get_type_id<TL, MaskAlternative<36>>::value()));
+    REQUIRE(!Mask::contains(type_list_get_type_id<TL, MaskAlternative<98>>::value()));
+    REQUIRE(Mask::contains(type_list_get_type_id<TL, MaskAlternative<99>>::value()));
+}
+
+namespace
+{
+    template <size_t N>
+    struct WideAlternative {};
+
+    template <typename Sequence>
+    struct make_wide_type_list;
+
+    template <size_t ... Indices>
+    struct make_wide_type_list<index_sequence<Indices...>>
+    {
+        using type = type_list<WideAlternative<Indices>...>;
+    };
+
+    using WideTL = make_wide_type_list<make_index_sequence<300>>::type;
+}
+
+TEST_CASE("Type list with more than 256 types test", "[type_list]")
+{
+    REQUIRE(type_list_get_size<WideTL>::value() == 300);
+
+    SECTION("Has correct type id's")
+    {
+        REQUIRE(type_list_get_type_id<WideTL, WideAlternative<0>>::value() == 299);
+        REQUIRE(type_list_get_type_id<WideTL, WideAlternative<43>>::value() == 256);
+        REQUIRE(type_list_get_type_id<WideTL, WideAlternative<44>>::value() == 255);
+        REQUIRE(type_list_get_type_id<WideTL, WideAlternative<299>>::value() == 0);
+    }
+
+    SECTION("Has correct type for id's")
+    {
+        REQUIRE(std::is_same<
+                typename type_list_get_type_for_id<WideTL, 299>::type,
+                WideAlternative<0>
+        >::value);
+        REQUIRE(std::is_same<
+                typename type_list_get_type_for_id<WideTL, 256>::type,
+                WideAlternative<43>
+        >::value);
+        REQUIRE(std::is_same<
+                typename type_list_get_type_for_id<WideTL, 300>::type,
+                type_list_null
+        >::value);
+    }
+
+    SECTION("Compact tag is selected by the type list size")
+    {
+        REQUIRE(std::is_same<type_list_compact_tag_t<type_list<int, char>>, uint8_t>::value);
+        REQUIRE(std::is_same<type_list_compact_tag_for_size<256>, uint8_t>::value);
+        REQUIRE(std::is_same<type_list_compact_tag_for_size<257>, uint16_t>::value);
+        REQUIRE(std::is_same<type_list_compact_tag_t<WideTL>, uint16_t>::value);
+    }
+
+    SECTION("Has type")
+    {
+        REQUIRE(type_list_has_type<WideTL, WideAlternative<150>>::value());
+        REQUIRE(!type_list_has_type<WideTL, WideAlternative<300>>::value());
+    }
+
+    SECTION("Remove same")
+    {
+        using TL = typename type_list_remove_same<WideTL, WideAlternative<1>>::type;
+
+        REQUIRE(type_list_get_size<TL>::value() == 299);
+        REQUIRE(!type_list_has_type<TL, WideAlternative<1>>::value());
+        REQUIRE(std::is_same<typename TL::tail::head, WideAlternative<2>>::value);
+    }
+
+    SECTION("Subset id mapping to the large superset")
+    {
+        using SubsetTL = type_list<WideAlternative<1>, WideAlternative<280>>;
+        using Mapper = type_list_subset_id_mapping<WideTL, SubsetTL>;
+
+        REQUIRE(
+                Mapper::get(type_list_get_type_id<SubsetTL, WideAlternative<1>>::value())
+                == type_list_get_type_id<WideTL, WideAlternative<1>>::value()
+        );
+        REQUIRE(
+                Mapper::get(type_list_get_type_id<SubsetTL, WideAlternative<280>>::value())
+                == type_list_get_type_id<WideTL, WideAlternative<280>>::value()
+        );
+    }
+
+    SECTION("Derived id mask")
+    {
+        using Mask = type_list_derived_id_mask<WideTL, WideAlternative<10>>;
+
+        REQUIRE(Mask::contains(type_list_get_type_id<WideTL, WideAlternative<10>>::value()));
+        REQUIRE(!Mask::contains(type_list_get_type_id<WideTL, WideAlternative<11>>::value()));
+        REQUIRE(!Mask::contains(type_list_get_type_id<WideTL, WideAlternative<0>>::value()));
+    }
+}
@@ -0,0 +1,238 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+#include <catch2/catch.hpp>
+
+#include <exl/mixed.hpp>
+#include <exl/inline_budget.hpp>
+
+#include <ClassMock.hpp>
+
+using namespace exl::impl;
+using namespace exl::test;
+
+namespace
+{
+    struct Message
+    {
+        virtual ~Message() = default;
+    };
+
+    struct Ping : Message
+    {
+        explicit Ping(uint32_t id)
+                : id(id) {}
+
+        uint32_t id;
+    };
+
+    struct Bulk : Message
+    {
+        explicit Bulk(char fill)
+        {
+            payload.fill(fill);
+        }
+
+        std::array<char, 4096> payload;
+    };
+
+    struct BulkMock : ClassMock
+    {
+        explicit BulkMock(Tag tag, CallCounter* calls = nullptr)
+                : ClassMock(tag, calls) {}
+
+        std::array<char, 256> payload;
+    };
+
+    using Packet = exl::mixed<exl::inline_budget<16>, uint8_t, Ping, Bulk>;
+    using MockPacket = exl::mixed<exl::inline_budget<16>, uint8_t, BulkMock>;
+}
+
+TEST_CASE("Inline budget layout test", "[inline_budget]")
+{
+    static_assert(
+            std::is_same<Packet::type_list_t, type_list<uint8_t, Ping, Bulk>>::value,
+            "Storage policy should not be the variant"
+    );
+    static_assert(
+            std::is_same<
+                    Packet::storage_type_list_t,
+                    type_list<uint8_t, Ping, mixed_boxed<Bulk>>
+            >::value,
+            "Only variants which exceed the budget should be stored out of line"
+    );
+    static_assert(
+            sizeof(Packet) == sizeof(exl::mixed<uint8_t, Ping>),
+            "Size of exl::mixed should not depend on the out of line variants size"
+    );
+    static_assert(
+            std::is_same<exl::mixed<exl::inline_budget<8>, uint8_t>::storage_type_list_t,
+            type_list<uint8_t>>::value,
+            "Variants which fit into the budget should be stored inline"
+    );
+}
+
+TEST_CASE("Inline budget access test", "[inline_budget]")
+{
+    Packet packet(Bulk('x'));
+
+    REQUIRE(packet.is<Bulk>());
+    REQUIRE(packet.is_exact<Bulk>());
+    REQUIRE(packet.is<Message>());
+    REQUIRE(!packet.is<Ping>());
+    REQUIRE(packet.tag() == Packet::tag_of<Bulk>());
+
+    REQUIRE(packet.unwrap<Bulk>().payload[4095] == 'x');
+    REQUIRE(packet.unwrap_exact<Bulk>().payload[0] == 'x');
+    REQUIRE(&packet.unwrap<Message>() == &packet.unwrap<Bulk>());
+
+    packet.unwrap<Bulk>().payload[0] = 'y';
+    const Packet& constPacket = packet;
+    REQUIRE(constPacket.unwrap<Bulk>().payload[0] == 'y');
+
+    SECTION("Inline variant is accessible through the base of the out of line variant")
+    {
+        packet = Ping(42);
+
+        REQUIRE(packet.unwrap<Ping>().id == 42);
+        REQUIRE(&packet.unwrap<Message>() == &packet.unwrap<Ping>());
+    }
+}
+
+TEST_CASE("Inline budget map test", "[inline_budget]")
+{
+    auto describe = [](const Packet& packet) -> std::string
+    {
+        return packet.map<std::string>(
+                exl::when_exact<Bulk>([](const Bulk& bulk)
+                {
+                    return std::string(1, bulk.payload[1]);
+                }),
+                exl::when<Message>([](const Message&)
+                {
+                    return std::string("message");
+                }),
+                exl::otherwise([]()
+                {
+                    return std::string("byte");
+                })
+        );
+    };
+
+    REQUIRE(describe(Packet(Bulk('b'))) == "b");
+    REQUIRE(describe(Packet(Ping(1))) == "message");
+    REQUIRE(describe(Packet(uint8_t(1))) == "byte");
+
+    SECTION("Base matcher receives out of line variant")
+    {
+        const Packet packet(Bulk('c'));
+        const Message* matched = nullptr;
+
+        packet.match(
+                exl::when<Message>([&matched](const Message& message) { matched = &message; }),
+                exl::otherwise([]() {})
+        );
+
+        REQUIRE(matched == &packet.unwrap<Bulk>());
+    }
+}
+
+TEST_CASE("Inline budget construction and assignment test", "[inline_budget]")
+{
+    CallCounter counter;
+
+    SECTION("Out of line variant is constructed in-place")
+    {
+        {
+            MockPacket packet(exl::in_place_type_t<BulkMock>(), Tag(1), &counter);
+            REQUIRE(packet.unwrap<BulkMock>().tag() == 1);
+        }
+
+        REQUIRE(counter.count(CallType::Construct, 1) == 1);
+        REQUIRE(counter.count(CallType::Copy, 1) == 0);
+        REQUIRE(counter.count(CallType::Move, 1) == 0);
+        REQUIRE(counter.count(CallType::Destroy, 1) == 1);
+    }
+
+    SECTION("Copy allocates new variant")
+    {
+        auto packet = MockPacket::make<BulkMock>(Tag(2), &counter);
+        MockPacket copy(packet);
+
+        REQUIRE(&copy.unwrap<BulkMock>() != &packet.unwrap<BulkMock>());
+        REQUIRE(copy.unwrap<BulkMock>().tag() == as_copied_tag(2));
+        REQUIRE(counter.count(CallType::Copy, 2) == 1);
+    }
+
+    SECTION("Move transfers the variant without allocation")
+    {
+        auto packet = MockPacket::make<BulkMock>(Tag(3), &counter);
+        const BulkMock* original = &packet.unwrap<BulkMock>();
+
+        MockPacket moved(std::move(packet));
+        MockPacket assigned(uint8_t(0));
+        assigned = std::move(moved);
+
+        REQUIRE(&assigned.unwrap<BulkMock>() == original);
+        REQUIRE(counter.count(CallType::Move, 3) == 0);
+        REQUIRE(counter.count(CallType::Copy, 3) == 0);
+        REQUIRE(counter.count(CallType::Destroy, 3) == 0);
+    }
+
+    SECTION("Moved-from variant can be copied and assigned")
+    {
+        auto packet = MockPacket::make<BulkMock>(Tag(4), &counter);
+        MockPacket moved(std::move(packet));
+
+        MockPacket copy(packet);
+        REQUIRE(copy.is<BulkMock>());
+
+        copy = moved;
+        REQUIRE(copy.unwrap<BulkMock>().original_tag() == 4);
+
+        copy = packet;
+        REQUIRE(copy.is<BulkMock>());
+
+        packet = moved;
+        REQUIRE(packet.unwrap<BulkMock>().original_tag() == 4);
+        REQUIRE(&packet.unwrap<BulkMock>() != &moved.unwrap<BulkMock>());
+    }
+
+    SECTION("Assignment")
+    {
+        MockPacket packet(uint8_t(1));
+
+        packet = BulkMock(Tag(4), &counter);
+        REQUIRE(packet.unwrap<BulkMock>().original_tag() == 4);
+
+        auto other = MockPacket::make<BulkMock>(Tag(5), &counter);
+        packet = other;
+        REQUIRE(packet.unwrap<BulkMock>().original_tag() == 5);
+        REQUIRE(other.unwrap<BulkMock>().tag() == 5);
+
+        packet.emplace<BulkMock>(Tag(6), &counter);
+        REQUIRE(packet.unwrap<BulkMock>().tag() == 6);
+
+        packet = uint8_t(7);
+        REQUIRE(packet.unwrap<uint8_t>() == 7);
+
+        REQUIRE(counter.count(CallType::Destroy, 6) == 1);
+    }
+
+    SECTION("Construction from the subset")
+    {
+        exl::mixed<exl::inline_budget<16>, BulkMock> bulk(BulkMock(Tag(8), &counter));
+        MockPacket packet(std::move(bulk));
+
+        REQUIRE(packet.unwrap<BulkMock>().original_tag() == 8);
+
+        packet = exl::mixed<uint8_t>(uint8_t(9));
+        REQUIRE(packet.unwrap<uint8_t>() == 9);
+    }
+}
@@ -6,6 +6,8 @@
 #include <string>
 #include <algorithm>
 #include <functional>
+#include <array>
+#include <system_error>
 
 #include <catch2/catch.hpp>
 
@@ -467,6 +469,35 @@ TEST_CASE("Mixed type construct from subset test when head type", "[mixed]")
     generic_test_construct_from_subset<Mixed, MixedSubset>();
 }
 
+TEST_CASE("Mixed type construct from suffix subset test", "[mixed]")
+{
+    using Mixed = exl::mixed<int, std::string, ClassMock, char>;
+    using MixedSuffix = exl::mixed<std::string, ClassMock, char>;
+
+    generic_test_construct_from_subset<Mixed, MixedSuffix>();
+
+    SECTION("Tag is preserved")
+    {
+        MixedSuffix suffix(std::string("suffix"));
+        Mixed m(suffix);
+
+        REQUIRE(m.tag() == suffix.tag());
+        REQUIRE(m.unwrap<std::string>() == "suffix");
+    }
+
+    SECTION("Trivially copyable suffix")
+    {
+        using Trivial = exl::mixed<uint64_t, double, char>;
+        using TrivialSuffix = exl::mixed<double, char>;
+
+        Trivial fromDouble(TrivialSuffix(2.5));
+        REQUIRE(fromDouble.unwrap<double>() == 2.5);
+
+        Trivial fromChar(TrivialSuffix('c'));
+        REQUIRE(fromChar.unwrap<char>() == 'c');
+    }
+}
+
 template <typename Mixed, typename MixedSubset>
 static void generic_test_assign_from_subset()
 {
@@ -939,6 +970,151 @@ TEST_CASE("Map with void return type (match) test", "[mixed]")
     }
 }
 
+namespace
+{
+    /// @brief Distinct types to reach the type list size of the table dispatch
+    template <int N>
+    struct Filler {};
+}
+
+TEST_CASE("Map with table dispatch test", "[mixed]")
+{
+    using Mixed = exl::mixed<
+            int,
+            std::runtime_error,
+            std::string,
+            std::logic_error,
+            std::invalid_argument,
+            char,
+            signed char,
+            short,
+            unsigned short,
+            unsigned,
+            long long,
+            unsigned long long,
+            float,
+            double,
+            long double,
+            Filler<0>,
+            Filler<1>,
+            Filler<2>,
+            Filler<3>,
+            Filler<4>,
+            Filler<5>,
+            Filler<6>,
+            Filler<7>,
+            Filler<8>,
+            Filler<9>,
+            Filler<10>,
+            Filler<11>,
+            Filler<12>,
+            Filler<13>,
+            Filler<14>,
+            Filler<15>,
+            ClassMock
+    >;
+
+    static_assert(
+            exl::impl::type_list_get_size<Mixed::type_list_t>::value()
+                    >= exl::impl::mixed_map_table_min_size,
+            "Type list is too small for table dispatch"
+    );
+
+    Mixed m(0);
+
+    int result = 0;
+    int mockTag = 0;
+
+    auto do_map = [&result, &mockTag, &m]() -> void
+    {
+        result = m.map<int>(
+                exl::when_exact<int>([](const int& value)
+                {
+                    return value;
+                }),
+                // std::invalid_argument is derived from std::logic_error, but exact matcher
+                // comes first
+                exl::when_exact<std::invalid_argument>([](const std::invalid_argument&)
+                {
+                    return 3;
+                }),
+                exl::when<std::exception>([](const std::exception& e)
+                {
+                    return std::string(e.what()) == "logic" ? 4 : 2;
+                }),
+                exl::when<ClassMock>([&mockTag](const ClassMock& mock)
+                {
+                    mockTag = mock.original_tag();
+                    return 5;
+                }),
+                exl::otherwise([]()
+                {
+                    return 42;
+                })
+        );
+    };
+
+    SECTION("On exact type")
+    {
+        m = int(7);
+        do_map();
+        REQUIRE(result == 7);
+    }
+
+    SECTION("On derived type")
+    {
+        m = std::runtime_error("runtime");
+        do_map();
+        REQUIRE(result == 2);
+
+        m = std::logic_error("logic");
+        do_map();
+        REQUIRE(result == 4);
+    }
+
+    SECTION("First matching matcher wins")
+    {
+        m = std::invalid_argument("invalid");
+        do_map();
+        REQUIRE(result == 3);
+    }
+
+    SECTION("On class")
+    {
+        m = ClassMock(11);
+        do_map();
+        REQUIRE(result == 5);
+        REQUIRE(mockTag == 11);
+    }
+
+    SECTION("On otherwise")
+    {
+        m = 'c';
+        do_map();
+        REQUIRE(result == 42);
+
+        m = 1.0;
+        do_map();
+        REQUIRE(result == 42);
+    }
+
+    SECTION("Match")
+    {
+        m = std::string("hi");
+        m.match(
+                exl::when_exact<std::string>([&result](const std::string& value)
+                {
+                    result = static_cast<int>(value.size());
+                }),
+                exl::otherwise([&result]()
+                {
+                    result = 42;
+                })
+        );
+        REQUIRE(result == 2);
+    }
+}
+
 TEST_CASE("Mixed make test", "[mixed]")
 {
     using Mixed = exl::mixed<int, std::runtime_error, std::string, ClassMock>;
@@ -967,4 +1143,350 @@ TEST_CASE("Mixed make test", "[mixed]")
         REQUIRE(m.is<std::string>());
         REQUIRE(m.unwrap<std::string>().empty());
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("Mixed type layout test", "[mixed]")
+{
+    SECTION("Has no virtual table")
+    {
+        static_assert(
+                !std::is_polymorphic<exl::mixed<int, std::string>>::value,
+                "exl::mixed should not be polymorphic"
+        );
+        static_assert(
+                sizeof(exl::mixed<int, char>) == 2 * sizeof(int),
+                "exl::mixed should occupy only storage and tag"
+        );
+        static_assert(
+                sizeof(exl::mixed<uint64_t, uint32_t>) == 2 * sizeof(uint64_t),
+                "exl::mixed should occupy only storage and tag"
+        );
+    }
+
+    SECTION("Trivially destructible when all types are trivially destructible")
+    {
+        static_assert(
+                std::is_trivially_destructible<exl::mixed<int, char, double>>::value,
+                "exl::mixed of trivially destructible types should be trivially destructible"
+        );
+        static_assert(
+                !std::is_trivially_destructible<exl::mixed<int, std::string>>::value,
+                "exl::mixed of non-trivially destructible types should not be trivial"
+        );
+    }
+
+    SECTION("Trivially copyable when all types are trivially copyable")
+    {
+        static_assert(
+                std::is_trivially_copyable<exl::mixed<uint32_t, std::errc>>::value,
+                "exl::mixed of trivially copyable types should be trivially copyable"
+        );
+        static_assert(
+                !std::is_trivially_copy_constructible<exl::mixed<int, std::string>>::value,
+                "exl::mixed of non-trivially copyable types should not be trivially copyable"
+        );
+        static_assert(
+                !std::is_trivially_move_assignable<exl::mixed<int, std::string>>::value,
+                "exl::mixed of non-trivially copyable types should not be trivially copyable"
+        );
+    }
+
+    SECTION("Trivial copy preserves value")
+    {
+        using Mixed = exl::mixed<uint32_t, std::errc>;
+
+        Mixed m1(std::errc::invalid_argument);
+        Mixed m2(uint32_t(42));
+
+        m2 = m1;
+        REQUIRE(m2.unwrap_exact<std::errc>() == std::errc::invalid_argument);
+
+        Mixed m3(m2);
+        REQUIRE(m3.unwrap_exact<std::errc>() == std::errc::invalid_argument);
+    }
+
+    SECTION("Tag is packed into storage tail padding")
+    {
+        using Packed = exl::mixed<std::array<char, 9>, uint64_t>;
+        using Unpacked = exl::mixed<uint64_t, uint32_t>;
+
+        static_assert(sizeof(Packed) == 2 * sizeof(uint64_t), "Tag should be in padding");
+        static_assert(exl::mixed_layout<Packed>::storage_offset() == 0, "Invalid layout");
+        static_assert(exl::mixed_layout<Packed>::storage_size() == 9, "Invalid layout");
+        static_assert(exl::mixed_layout<Packed>::tag_offset() == 9, "Invalid layout");
+        static_assert(exl::mixed_layout<Packed>::tag_size() == 1, "Invalid layout");
+        static_assert(exl::mixed_layout<Packed>::padding() == 6, "Invalid layout");
+        static_assert(exl::mixed_layout<Packed>::is_tag_packed(), "Invalid layout");
+
+        static_assert(sizeof(exl::mixed<std::array<char, 3>, uint16_t>) == 4, "Invalid layout");
+
+        static_assert(exl::mixed_layout<Unpacked>::tag_offset() == 8, "Invalid layout");
+        static_assert(exl::mixed_layout<Unpacked>::padding() == 7, "Invalid layout");
+        static_assert(!exl::mixed_layout<Unpacked>::is_tag_packed(), "Invalid layout");
+    }
+
+    SECTION("Storage type doesn't depend on the language standard")
+    {
+        // This test is built as C++11, see mixed_constexpr_test.cpp for C++14 and later
+        static_assert(
+                exl::impl::mixed_uses_literal_union<exl::impl::type_list<int, float>>::value(),
+                "Trivially copyable variants should use the literal union in any standard"
+        );
+    }
+}
+
+namespace
+{
+    template <size_t N>
+    struct WideAlternative
+    {
+        explicit WideAlternative(int v) : value(v) {}
+
+        int value;
+    };
+
+    template <typename Sequence>
+    struct make_wide_mixed;
+
+    template <size_t ... Indices>
+    struct make_wide_mixed<index_sequence<Indices...>>
+    {
+        using type = exl::mixed<std::string, WideAlternative<Indices>...>;
+    };
+}
+
+TEST_CASE("Mixed with more than 256 alternatives test", "[mixed]")
+{
+    using Mixed = make_wide_mixed<make_index_sequence<300>>::type;
+
+    static_assert(std::is_same<Mixed::tag_t, uint16_t>::value, "Invalid tag type");
+    static_assert(exl::mixed_layout<Mixed>::tag_size() == 2, "Invalid layout");
+    static_assert(
+            std::is_same<exl::mixed<int, char>::tag_t, uint8_t>::value,
+            "Small type lists should keep single byte tag"
+    );
+
+    auto m = Mixed::make<WideAlternative<280>>(42);
+
+    REQUIRE(m.tag() == Mixed::tag_of<WideAlternative<280>>());
+    REQUIRE(m.is<WideAlternative<280>>());
+    REQUIRE(!m.is<WideAlternative<24>>());
+    REQUIRE(m.unwrap<WideAlternative<280>>().value == 42);
+
+    SECTION("Map")
+    {
+        auto result = m.map<int>(
+                exl::when<WideAlternative<24>>([](const WideAlternative<24>&) { return 0; }),
+                exl::when<WideAlternative<280>>([](const WideAlternative<280>& v)
+                {
+                    return v.value;
+                }),
+                exl::otherwise([]() { return -1; })
+        );
+        REQUIRE(result == 42);
+    }
+
+    SECTION("Copy and assignment")
+    {
+        Mixed copy(m);
+        REQUIRE(copy.unwrap_exact<WideAlternative<280>>().value == 42);
+
+        copy = std::string("wide");
+        REQUIRE(copy.unwrap_exact<std::string>() == "wide");
+
+        copy = m;
+        REQUIRE(copy.unwrap_exact<WideAlternative<280>>().value == 42);
+    }
+
+    SECTION("Conversion from subset")
+    {
+        using Subset = exl::mixed<WideAlternative<3>, WideAlternative<299>, std::string>;
+
+        Subset subset(WideAlternative<299>(7));
+        Mixed superset(subset);
+        REQUIRE(superset.unwrap_exact<WideAlternative<299>>().value == 7);
+
+        superset = Subset(std::string("subset"));
+        REQUIRE(superset.unwrap_exact<std::string>() == "subset");
+    }
+}
+
+TEST_CASE("Map with mutable access test", "[mixed]")
+{
+    using Mixed = exl::mixed<int, std::string, ClassMock>;
+
+    Mixed m(std::string("hello"));
+
+    m.match(
+            exl::when<std::string>([](std::string& value) { value += " world"; }),
+            exl::otherwise([]() {})
+    );
+    REQUIRE(m.unwrap<std::string>() == "hello world");
+
+    SECTION("Table dispatch")
+    {
+        using Wide = make_wide_mixed<make_index_sequence<20>>::type;
+
+        Wide wide(std::string("wide"));
+        wide.match(
+                exl::when_exact<std::string>([](std::string& value) { value += "r"; }),
+                exl::otherwise([]() {})
+        );
+        REQUIRE(wide.unwrap<std::string>() == "wider");
+    }
+}
+
+TEST_CASE("Map of rvalue test", "[mixed]")
+{
+    using Mixed = exl::mixed<int, std::string, ClassMock>;
+
+    SECTION("Value is passed as rvalue")
+    {
+        CallCounter counter;
+
+        auto taken = Mixed::make<ClassMock>(1, &counter).map<ClassMock>(
+                exl::when<ClassMock>([](ClassMock&& value) { return std::move(value); }),
+                exl::otherwise([]() { return ClassMock(); })
+        );
+
+        REQUIRE(taken.original_tag() == 1);
+        REQUIRE(counter.count(CallType::Copy, 1) == 0);
+        REQUIRE(counter.count(CallType::Move, 1) == 1);
+    }
+
+    SECTION("Payload is moved out without copy")
+    {
+        Mixed m(std::string(64, 'x'));
+        const char* data = m.unwrap<std::string>().data();
+
+        std::string body;
+        std::move(m).match(
+                exl::when<std::string>([&body](std::string&& value) { body = std::move(value); }),
+                exl::otherwise([]() {})
+        );
+
+        REQUIRE(body.data() == data);
+    }
+
+    SECTION("Table dispatch")
+    {
+        using Wide = make_wide_mixed<make_index_sequence<20>>::type;
+
+        Wide wide(std::string(64, 'y'));
+        const char* data = wide.unwrap<std::string>().data();
+
+        auto body = std::move(wide).map<std::string>(
+                exl::when<std::string>([](std::string&& value) { return std::move(value); }),
+                exl::otherwise([]() { return std::string(); })
+        );
+
+        REQUIRE(body.data() == data);
+    }
+
+    SECTION("Const handlers accept rvalue")
+    {
+        auto size = Mixed(std::string("abc")).map<size_t>(
+                exl::when<std::string>([](const std::string& value) { return value.size(); }),
+                exl::otherwise([]() { return size_t(0); })
+        );
+
+        REQUIRE(size == 3);
+    }
+}
+
+TEST_CASE("Unwrap of rvalue test", "[mixed]")
+{
+    using Mixed = exl::mixed<int, std::string>;
+
+    static_assert(
+            std::is_same<decltype(Mixed(1).unwrap<int>()), int&&>::value,
+            "Unwrap of rvalue should return rvalue reference"
+    );
+    static_assert(
+            std::is_same<decltype(Mixed(1).unwrap_exact<int>()), int&&>::value,
+            "Unwrap of rvalue should return rvalue reference"
+    );
+
+    Mixed m(std::string(64, 'z'));
+    const char* data = m.unwrap<std::string>().data();
+
+    std::string value = std::move(m).unwrap_exact<std::string>();
+
+    REQUIRE(value.data() == data);
+}
+
+TEST_CASE("Mixed take test", "[mixed]")
+{
+    using Mixed = exl::mixed<int, std::string, ClassMock>;
+
+    SECTION("Value is moved out")
+    {
+        CallCounter counter;
+        auto m = Mixed::make<ClassMock>(1, &counter);
+
+        ClassMock value = m.take<ClassMock>();
+
+        REQUIRE(value.original_tag() == 1);
+        REQUIRE(m.is<ClassMock>());
+        REQUIRE(counter.count(CallType::Copy, 1) == 0);
+        REQUIRE(counter.count(CallType::Move, 1) == 1);
+    }
+
+    SECTION("Heap payload is not copied")
+    {
+        Mixed m(std::string(64, 'w'));
+        const char* data = m.unwrap<std::string>().data();
+
+        REQUIRE(m.take<std::string>().data() == data);
+    }
+}
+
+TEST_CASE("Mixed swap test", "[mixed]")
+{
+    SECTION("Values of the same type are swapped in-place")
+    {
+        using Mixed = exl::mixed<int, std::string>;
+
+        Mixed lhs(std::string("lhs"));
+        Mixed rhs(std::string("rhs"));
+
+        lhs.swap(rhs);
+
+        REQUIRE(lhs.unwrap<std::string>() == "rhs");
+        REQUIRE(rhs.unwrap<std::string>() == "lhs");
+    }
+
+    SECTION("Values of the different types are swapped")
+    {
+        using Mixed = exl::mixed<int, std::string>;
+
+        Mixed lhs(std::string("lhs"));
+        Mixed rhs(42);
+
+        std::swap(lhs, rhs);
+
+        REQUIRE(lhs.unwrap<int>() == 42);
+        REQUIRE(rhs.unwrap<std::string>() == "lhs");
+    }
+
+    SECTION("Trivially relocatable values are swapped bytewise")
+    {
+        using Mixed = exl::mixed<int, exl::box<ClassMock>>;
+        CallCounter calls;
+
+        Mixed lhs(exl::box<ClassMock>::make(1, &calls));
+        Mixed rhs(exl::box<ClassMock>::make(2, &calls));
+        const ClassMock* lhsValue = &*lhs.unwrap<exl::box<ClassMock>>();
+
+        lhs.swap(rhs);
+        REQUIRE(&*rhs.unwrap<exl::box<ClassMock>>() == lhsValue);
+
+        rhs = 3;
+        std::swap(lhs, rhs);
+
+        REQUIRE(lhs.unwrap<int>() == 3);
+        REQUIRE(rhs.unwrap<exl::box<ClassMock>>()->tag() == 2);
+        REQUIRE(calls.count(CallType::Destroy, 1) == 1);
+        REQUIRE(calls.count(CallType::Destroy, 2) == 0);
+    }
+}
@@ -0,0 +1,151 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+// Compile-time test: exl::mixed and exl::option of trivially copyable types are evaluated in
+// constant expressions when compiled as C++14 or later. Test passes when it compiles.
+
+#include <cstdint>
+
+#include <exl/matchers.hpp>
+#include <exl/mixed.hpp>
+#include <exl/option.hpp>
+
+namespace
+{
+    struct Register
+    {
+        uint8_t index;
+    };
+
+    using Operand = exl::mixed<int32_t, Register>;
+    using Instruction = exl::mixed<Operand, uint32_t>;
+
+    struct ImmediateCost
+    {
+        constexpr int operator()(const int32_t&) const
+        {
+            return 1;
+        }
+    };
+
+    struct RegisterCost
+    {
+        constexpr int operator()(const Register& reg) const
+        {
+            return 2 + reg.index;
+        }
+    };
+
+    struct DefaultCost
+    {
+        constexpr int operator()() const
+        {
+            return 0;
+        }
+    };
+
+    constexpr int cost(const Operand& operand)
+    {
+        return operand.map<int>(
+                exl::when<int32_t>(ImmediateCost()),
+                exl::when<Register>(RegisterCost())
+        );
+    }
+
+    constexpr int sum_immediates(const Operand* first, const Operand* last)
+    {
+        int sum = 0;
+        for (; first != last; ++first)
+        {
+            if (first->is<int32_t>())
+            {
+                sum += first->unwrap<int32_t>();
+            }
+        }
+        return sum;
+    }
+
+    constexpr Operand operands[] = {
+            Operand(int32_t(10)),
+            Operand(Register { 3 }),
+            Operand(int32_t(-4)),
+    };
+
+    // Construction and queries
+    static_assert(operands[0].is<int32_t>(), "");
+    static_assert(operands[1].is_exact<Register>(), "");
+    static_assert(!operands[1].is<int32_t>(), "");
+    static_assert(operands[1].unwrap<Register>().index == 3, "");
+    static_assert(operands[2].unwrap_exact<int32_t>() == -4, "");
+    static_assert(operands[0].tag() == Operand::tag_of<int32_t>(), "");
+
+    // Map with constexpr functors
+    static_assert(cost(operands[0]) == 1, "");
+    static_assert(cost(operands[1]) == 5, "");
+    static_assert(sum_immediates(operands, operands + 3) == 6, "");
+
+    static_assert(
+            Operand(Register { 1 }).map<int>(
+                    exl::when<int32_t>(ImmediateCost()),
+                    exl::otherwise(DefaultCost())
+            ) == 0,
+            ""
+    );
+
+    // Nested mixed
+    constexpr Instruction instruction(exl::in_place_type_t<Operand>(), Register { 7 });
+    static_assert(instruction.is<Operand>(), "");
+    static_assert(instruction.unwrap<Operand>().unwrap<Register>().index == 7, "");
+    static_assert(Instruction(uint32_t(5)).unwrap<uint32_t>() == 5, "");
+
+    // Options
+    constexpr exl::option<uint32_t> some = uint32_t(42);
+    constexpr exl::option<uint32_t> none = exl::none();
+    static_assert(some.is_some() && some.unwrap_some() == 42, "");
+    static_assert(none.is_none(), "");
+
+    // Exclusions: storages which are not usable in constant expressions, see exl::mixed
+    struct Five
+    {
+        uint8_t bytes[5];
+    };
+
+    template <typename Mixed>
+    constexpr bool uses_literal_union()
+    {
+        return exl::impl::mixed_uses_literal_union<typename Mixed::storage_type_list_t>::value();
+    }
+
+    static_assert(uses_literal_union<Operand>(), "");
+    static_assert(uses_literal_union<exl::option<uint32_t>>(), "");
+    static_assert(
+            !uses_literal_union<exl::option<const int*>>(),
+            "Niche-optimized option keeps the raw storage"
+    );
+    static_assert(
+            !uses_literal_union<exl::mixed<Five, int>>(),
+            "Variants with the tail padding keep the raw storage"
+    );
+    static_assert(
+            sizeof(exl::mixed<Five, int>) == 8,
+            "Tag is placed after the 5-byte variant, union storage would make it 12 bytes"
+    );
+
+#if __cplusplus >= 201703L
+    // Lambdas are constexpr since C++17
+    static_assert(
+            some.map<uint32_t>(
+                    exl::when<uint32_t>([](uint32_t value) { return value + 1; }),
+                    exl::when<exl::none>([](exl::none) { return uint32_t(0); })
+            ) == 43,
+            ""
+    );
+#endif
+}
+
+int main()
+{
+    return operands[0].is<int32_t>() ? 0 : 1;
+}
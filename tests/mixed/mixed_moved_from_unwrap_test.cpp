@@ -0,0 +1,24 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <array>
+#include <utility>
+
+#include <exl/inline_budget.hpp>
+#include <exl/mixed.hpp>
+
+#include <termination_test.hpp>
+
+void termination_test()
+{
+    using Bulk = std::array<char, 64>;
+    using Packet = exl::mixed<exl::inline_budget<8>, int, Bulk>;
+
+    Packet packet(exl::in_place_type_t<Bulk>{});
+    Packet moved(std::move(packet));
+
+    // Heap alternative has been moved out, the slot is empty
+    packet.unwrap<Bulk>();
+}
@@ -0,0 +1,69 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstdint>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <exl/impl/mixed_vector/tag_scan.hpp>
+
+using namespace exl::impl;
+
+template <typename Scan, typename Tag>
+void test_tag_scan()
+{
+    // Sizes cover the empty array, the tail only and the full blocks with the tail
+    for (size_t size : { 0, 5, 16, 37, 100 })
+    {
+        std::vector<Tag> tags(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            tags[i] = Tag(i % 7);
+        }
+
+        const Tag targets[] = { Tag(3), Tag(5) };
+        const Tag missing[] = { Tag(9) };
+
+        size_t expected = 0;
+        size_t expectedFirst = size;
+        for (size_t i = 0; i < size; ++i)
+        {
+            if (tags[i] == 3 || tags[i] == 5)
+            {
+                ++expected;
+                expectedFirst = expectedFirst == size ? i : expectedFirst;
+            }
+        }
+
+        REQUIRE(Scan::count(tags.data(), size, targets, 2) == expected);
+        REQUIRE(Scan::find(tags.data(), size, targets, 2) == expectedFirst);
+        REQUIRE(Scan::count(tags.data(), size, missing, 1) == 0);
+        REQUIRE(Scan::find(tags.data(), size, missing, 1) == size);
+        REQUIRE(Scan::count(tags.data(), size, targets, 0) == 0);
+    }
+
+    SECTION("Match in the last block")
+    {
+        std::vector<Tag> tags(48, Tag(1));
+        tags[45] = Tag(2);
+
+        const Tag target = Tag(2);
+
+        REQUIRE(Scan::find(tags.data(), tags.size(), &target, 1) == 45);
+        REQUIRE(Scan::find(tags.data() + 46, 2, &target, 1) == 2);
+    }
+}
+
+TEST_CASE("Tag scan test", "[tag_scan]")
+{
+    test_tag_scan<tag_scan<uint8_t>, uint8_t>();
+}
+
+TEST_CASE("Tag scan scalar implementation test", "[tag_scan]")
+{
+    test_tag_scan<tag_scan_scalar<uint8_t>, uint8_t>();
+    test_tag_scan<tag_scan<uint16_t>, uint16_t>();
+}
@@ -0,0 +1,271 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <exl/mixed_vector.hpp>
+#include <exl/impl/exceptions.hpp>
+
+#include <ClassMock.hpp>
+
+using namespace exl::test;
+
+namespace
+{
+    struct Event
+    {
+        virtual ~Event() = default;
+    };
+
+    struct Click : Event
+    {
+        Click(int x, int y)
+                : x(x)
+                , y(y) {}
+
+        int x;
+        int y;
+    };
+
+    struct Scroll : Event
+    {
+        explicit Scroll(int delta)
+                : delta(delta) {}
+
+        int delta;
+    };
+
+    using Events = exl::mixed_vector<Click, Scroll, std::string>;
+
+    struct ThrowingValue
+    {
+        explicit ThrowingValue(bool fail)
+        {
+            if (fail)
+            {
+#if EXL_EXCEPTIONS
+                throw 1;
+#endif
+            }
+        }
+    };
+
+    Events make_events()
+    {
+        Events events;
+        events.push_back(Click(1, 2));
+        events.push_back(Scroll(-3));
+        events.push_back(std::string("key"));
+        events.emplace_back<Click>(4, 5);
+        events.emplace_back<Scroll>(6);
+        return events;
+    }
+}
+
+TEST_CASE("Mixed vector element access test", "[mixed_vector]")
+{
+    auto events = make_events();
+
+    REQUIRE(events.size() == 5);
+    REQUIRE(!events.empty());
+
+    REQUIRE(events[0].is_exact<Click>());
+    REQUIRE(events[0].is<Event>());
+    REQUIRE(events[0].tag() == Events::tag_of<Click>());
+    REQUIRE(events[1].is<Scroll>());
+    REQUIRE(!events[1].is<Click>());
+    REQUIRE(!events[2].is<Event>());
+
+    REQUIRE(events[0].unwrap_exact<Click>().y == 2);
+    REQUIRE(events[3].unwrap<Click>().x == 4);
+    REQUIRE(events[4].unwrap<Scroll>().delta == 6);
+    REQUIRE(events[2].unwrap<std::string>() == "key");
+    REQUIRE(&events[1].unwrap<Event>() == &events[1].unwrap<Scroll>());
+
+    SECTION("Values are modified in-place")
+    {
+        events[1].unwrap<Scroll>().delta = 10;
+        REQUIRE(events[1].unwrap_exact<Scroll>().delta == 10);
+    }
+
+    SECTION("Const access")
+    {
+        const Events& constEvents = events;
+        Events::const_reference ref = events[2];
+
+        REQUIRE(constEvents[3].unwrap<Click>().x == 4);
+        REQUIRE(ref.unwrap<std::string>() == "key");
+    }
+
+    SECTION("Conversion to mixed")
+    {
+        auto value = events[2].to_mixed();
+
+        REQUIRE(value.is<std::string>());
+        REQUIRE(value.unwrap<std::string>() == "key");
+    }
+}
+
+TEST_CASE("Mixed vector map test", "[mixed_vector]")
+{
+    auto events = make_events();
+
+    std::vector<std::string> described;
+    for (auto event : events)
+    {
+        described.push_back(event.map<std::string>(
+                exl::when<Click>([](const Click& click)
+                {
+                    return "click " + std::to_string(click.x);
+                }),
+                exl::when<Event>([](const Event&)
+                {
+                    return std::string("event");
+                }),
+                exl::otherwise([]()
+                {
+                    return std::string("other");
+                })
+        ));
+    }
+
+    REQUIRE(described == std::vector<std::string> {
+            "click 1", "event", "other", "click 4", "event"
+    });
+
+    SECTION("Match with mutable access")
+    {
+        events[4].match(
+                exl::when<Scroll>([](Scroll& scroll) { scroll.delta = 7; }),
+                exl::otherwise([]() {})
+        );
+
+        REQUIRE(events[4].unwrap<Scroll>().delta == 7);
+    }
+}
+
+TEST_CASE("Mixed vector per-type iteration test", "[mixed_vector]")
+{
+    auto events = make_events();
+
+    std::vector<int> clicks;
+    events.for_each_of<Click>([&clicks](Click& click) { clicks.push_back(click.x); });
+    REQUIRE(clicks == std::vector<int> { 1, 4 });
+
+    const Events& constEvents = events;
+    int deltas = 0;
+    constEvents.for_each_of<Scroll>([&deltas](const Scroll& scroll) { deltas += scroll.delta; });
+    REQUIRE(deltas == 3);
+}
+
+TEST_CASE("Mixed vector count and find test", "[mixed_vector]")
+{
+    Events events;
+    for (int i = 0; i < 100; ++i)
+    {
+        if (i % 10 == 9)
+        {
+            events.push_back(std::string("key"));
+        }
+        else if (i % 2 == 0)
+        {
+            events.emplace_back<Click>(i, i);
+        }
+        else
+        {
+            events.emplace_back<Scroll>(i);
+        }
+    }
+
+    REQUIRE(events.count<std::string>() == 10);
+    REQUIRE(events.count<Event>() == 90);
+    REQUIRE(events.count_exact<Click>() == 50);
+    REQUIRE(events.count_exact<Scroll>(0, 10) == 4);
+    REQUIRE(events.count<Event>(90, 100) == 9);
+
+    REQUIRE(events.find<std::string>() == 9);
+    REQUIRE(events.find<std::string>(10) == 19);
+    REQUIRE(events.find_exact<Scroll>(2) == 3);
+    REQUIRE(events.find<Event>(99) == 100);
+
+    REQUIRE(events.count<int>() == 0);
+    REQUIRE(events.find<int>() == 100);
+}
+
+TEST_CASE("Mixed vector bool values test", "[mixed_vector]")
+{
+    exl::mixed_vector<int, bool> values;
+    values.push_back(1);
+    values.push_back(true);
+    values.emplace_back<bool>();
+    values.push_back(false);
+
+    REQUIRE(values.count<bool>() == 3);
+    REQUIRE(values.find<bool>() == 1);
+    REQUIRE(values[1].unwrap_exact<bool>());
+    REQUIRE_FALSE(values[2].unwrap_exact<bool>());
+
+    bool& flag = values[3].unwrap_exact<bool>();
+    flag = true;
+    REQUIRE(values[3].unwrap<bool>());
+
+    int set = 0;
+    values.for_each_of<bool>([&set](bool& value) { set += value ? 1 : 0; });
+    REQUIRE(set == 2);
+
+    REQUIRE(values[2].map<int>(
+            exl::when_exact<int>([](int) { return 0; }),
+            exl::when_exact<bool>([](bool& value) { return value ? 2 : 1; })
+    ) == 1);
+}
+
+TEST_CASE("Mixed vector removal test", "[mixed_vector]")
+{
+    CallCounter calls;
+    exl::mixed_vector<int, ClassMock> values;
+    values.reserve(4);
+    values.reserve_of<ClassMock>(4);
+
+    values.emplace_back<ClassMock>(1, &calls);
+    values.push_back(2);
+    values.emplace_back<ClassMock>(3, &calls);
+
+    values.pop_back();
+    REQUIRE(values.size() == 2);
+    REQUIRE(values.count_exact<ClassMock>() == 1);
+    REQUIRE(calls.count(CallType::Destroy, 3) == 1);
+
+    values.emplace_back<ClassMock>(4, &calls);
+    REQUIRE(values[2].unwrap<ClassMock>().tag() == 4);
+
+    values.clear();
+    REQUIRE(values.empty());
+    REQUIRE(calls.count(CallType::Destroy, 1) == 1);
+    REQUIRE(calls.count(CallType::Destroy, 4) == 1);
+
+    values.push_back(5);
+    REQUIRE(values[0].unwrap<int>() == 5);
+}
+
+#if EXL_EXCEPTIONS
+TEST_CASE("Mixed vector failed insertion test", "[mixed_vector]")
+{
+    exl::mixed_vector<int, ThrowingValue> values;
+    values.push_back(1);
+    values.emplace_back<ThrowingValue>(false);
+
+    REQUIRE_THROWS(values.emplace_back<ThrowingValue>(true));
+    REQUIRE(values.size() == 2);
+    REQUIRE(values.count_exact<ThrowingValue>() == 1);
+
+    values.push_back(3);
+    REQUIRE(values[2].unwrap<int>() == 3);
+    REQUIRE(values[1].is<ThrowingValue>());
+}
+#endif
@@ -0,0 +1,14 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <exl/mixed_vector.hpp>
+
+#include <termination_test.hpp>
+
+void termination_test()
+{
+    exl::mixed_vector<char, int> values;
+    values.pop_back();
+}
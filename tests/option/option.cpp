@@ -5,12 +5,54 @@
 
 #include <catch2/catch.hpp>
 
+#include <cstdint>
+
 #include <exl/option.hpp>
+#include <exl/box.hpp>
 
 #include <ClassMock.hpp>
 
 using namespace exl::test;
 
+namespace
+{
+    struct Index
+    {
+        uint32_t value;
+    };
+}
+
+namespace
+{
+    /// @brief Value which is constructible from anything, including exl::option
+    struct AnyValue
+    {
+        AnyValue() = default;
+
+        template <typename U>
+        AnyValue(U&&) {}
+    };
+}
+
+namespace exl
+{
+    template <>
+    struct niche_traits<Index>
+    {
+        static constexpr bool has_niche() { return true; }
+
+        static bool is_niche(const Index& index) noexcept
+        {
+            return index.value == UINT32_MAX;
+        }
+
+        static void construct_niche(void* storage) noexcept
+        {
+            new(storage) Index { UINT32_MAX };
+        }
+    };
+}
+
 TEST_CASE("Option construction test", "[option]")
 {
     SECTION("Best match construction")
@@ -36,6 +78,67 @@ TEST_CASE("Option construction test", "[option]")
     }
 }
 
+TEST_CASE("Option copy test", "[option]")
+{
+    static_assert(
+            std::is_trivially_copy_constructible<exl::option<uint64_t>>::value,
+            "exl::option of trivially copyable type should be trivially copy-constructible"
+    );
+    static_assert(
+            std::is_nothrow_constructible<exl::option<uint64_t>, exl::option<uint64_t>&>::value,
+            "Copy from non-const lvalue should select the trivial copy constructor"
+    );
+    static_assert(
+            std::is_nothrow_assignable<exl::option<uint64_t>&, exl::option<uint64_t>&>::value,
+            "Copy assignment from non-const lvalue should select the trivial copy assignment"
+    );
+
+    SECTION("Copy from non-const lvalue uses copy constructor")
+    {
+        auto none = exl::option<AnyValue>::make_none();
+        exl::option<AnyValue> copy = none;
+
+        REQUIRE(copy.is_none());
+    }
+
+    SECTION("Copy assignment from non-const lvalue uses copy assignment")
+    {
+        auto none = exl::option<AnyValue>::make_none();
+        auto some = exl::option<AnyValue>::make_some();
+        some = none;
+
+        REQUIRE(some.is_none());
+    }
+
+    SECTION("Move from non-const rvalue uses move constructor")
+    {
+        auto none = exl::option<AnyValue>::make_none();
+        exl::option<AnyValue> moved = std::move(none);
+
+        REQUIRE(moved.is_none());
+    }
+}
+
+TEST_CASE("Option layout test", "[option]")
+{
+    static_assert(
+            sizeof(exl::option<int>) == 2 * sizeof(int),
+            "exl::option should occupy only storage and tag"
+    );
+    static_assert(
+            std::is_trivially_destructible<exl::option<int>>::value,
+            "exl::option of trivially destructible type should be trivially destructible"
+    );
+    static_assert(
+            !std::is_trivially_destructible<exl::option<std::string>>::value,
+            "exl::option of non-trivially destructible type should not be trivially destructible"
+    );
+    static_assert(
+            std::is_trivially_copyable<exl::option<uint64_t>>::value,
+            "exl::option of trivially copyable type should be trivially copyable"
+    );
+}
+
 TEST_CASE("Option forward assignment", "[option]")
 {
     CallCounter counter;
@@ -142,4 +245,149 @@ TEST_CASE("Option const unwrap some test", "[option]")
 {
     const auto option = exl::option<std::string>::make_some("hello");
     REQUIRE(option.unwrap_some() == std::string("hello"));
-}
\ No newline at end of file
+}
+
+TEST_CASE("Option niche optimization layout test", "[option]")
+{
+    static_assert(sizeof(exl::option<int*>) == sizeof(int*), "Invalid niche layout");
+    static_assert(sizeof(exl::option<exl::box<int>>) == sizeof(int*), "Invalid niche layout");
+    static_assert(sizeof(exl::option<Index>) == sizeof(Index), "Invalid niche layout");
+
+    static_assert(exl::mixed_layout<exl::option<int*>>::is_niche_optimized(), "Invalid layout");
+    static_assert(exl::mixed_layout<exl::option<int*>>::tag_size() == 0, "Invalid layout");
+    static_assert(!exl::mixed_layout<exl::option<int>>::is_niche_optimized(), "Invalid layout");
+    static_assert(
+            !exl::mixed_layout<exl::mixed<int*, exl::none>>::is_niche_optimized(),
+            "Only exl::option should use the niche layout"
+    );
+
+    static_assert(
+            std::is_trivially_copyable<exl::option<int*>>::value,
+            "exl::option of pointer should be trivially copyable"
+    );
+}
+
+TEST_CASE("Option niche optimization test", "[option]")
+{
+    int value = 42;
+
+    SECTION("Pointer")
+    {
+        auto option = exl::option<int*>::make_none();
+        REQUIRE(option.is_none());
+
+        option = &value;
+        REQUIRE(option.is_some());
+        REQUIRE(*option.unwrap_some() == 42);
+
+        option = exl::none();
+        REQUIRE(option.is_none());
+    }
+
+    SECTION("Pointer conversion to superset")
+    {
+        exl::option<int*> some(&value);
+        exl::option<int*> none(exl::none{});
+
+        exl::mixed<std::string, exl::none, int*> someSuperset(some);
+        REQUIRE(someSuperset.is<int*>());
+        REQUIRE(someSuperset.unwrap<int*>() == &value);
+
+        exl::mixed<std::string, exl::none, int*> noneSuperset(none);
+        REQUIRE(noneSuperset.is<exl::none>());
+    }
+
+    SECTION("Pointer conversion from same type list")
+    {
+        exl::mixed<int*, exl::none> mixed(&value);
+        exl::option<int*> option(mixed);
+
+        REQUIRE(option.is_some());
+        REQUIRE(option.unwrap_some() == &value);
+    }
+
+    SECTION("Plain mixed keeps stored nullptr as value")
+    {
+        exl::mixed<int*, exl::none> mixed(static_cast<int*>(nullptr));
+
+        REQUIRE(mixed.is<int*>());
+        REQUIRE(!mixed.is<exl::none>());
+        REQUIRE(mixed.unwrap<int*>() == nullptr);
+
+        exl::option<int*> none(exl::none{});
+        exl::mixed<int*, exl::none> converted(none);
+        REQUIRE(converted.is<exl::none>());
+
+        mixed = exl::option<int*>(&value);
+        REQUIRE(mixed.unwrap<int*>() == &value);
+    }
+
+    SECTION("Custom niche")
+    {
+        auto option = exl::option<Index>::make_some(Index { 5 });
+        REQUIRE(option.is_some());
+        REQUIRE(option.unwrap_some().value == 5);
+
+        option = exl::none();
+        REQUIRE(option.is_none());
+
+        option = Index { 7 };
+        REQUIRE(option.unwrap_some().value == 7);
+    }
+
+    SECTION("Box")
+    {
+        CallCounter counter;
+
+        {
+            exl::option<exl::box<ClassMock>> option(exl::box<ClassMock>::make(1, &counter));
+            REQUIRE(option.is_some());
+            REQUIRE(option.unwrap_some()->tag() == 1);
+
+            auto moved = std::move(option);
+            REQUIRE(moved.is_some());
+            REQUIRE(option.is_none());
+
+            option = exl::box<ClassMock>::make(2, &counter);
+            REQUIRE(option.is_some());
+
+            option = exl::none();
+            REQUIRE(option.is_none());
+            REQUIRE(counter.count(CallType::Destroy, 2) == 1);
+        }
+
+        REQUIRE(counter.count(CallType::Destroy, 1) == 1);
+    }
+}
+
+TEST_CASE("Option swap test", "[option]")
+{
+    SECTION("Value with none")
+    {
+        auto some = exl::option<int>::make_some(42);
+        auto none = exl::option<int>::make_none();
+
+        std::swap(some, none);
+
+        REQUIRE(some.is_none());
+        REQUIRE(none.unwrap_some() == 42);
+    }
+
+    SECTION("Niche optimized box")
+    {
+        CallCounter counter;
+
+        {
+            exl::option<exl::box<ClassMock>> some(exl::box<ClassMock>::make(1, &counter));
+            auto none = exl::option<exl::box<ClassMock>>::make_none();
+
+            some.swap(none);
+
+            REQUIRE(some.is_none());
+            REQUIRE(none.unwrap_some()->tag() == 1);
+            REQUIRE(counter.count(CallType::Destroy, 1) == 0);
+        }
+
+        REQUIRE(counter.count(CallType::Destroy, 1) == 1);
+    }
+}
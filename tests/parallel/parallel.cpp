@@ -0,0 +1,207 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <exl/option.hpp>
+#include <exl/parallel.hpp>
+#include <exl/result.hpp>
+
+namespace
+{
+    struct Overflow
+    {
+        int value;
+    };
+
+    using Value = exl::mixed<int, std::string>;
+    using Output = exl::result<int, Overflow>;
+
+    // Range spans several chunks of the parallel algorithms
+    constexpr int VALUES_COUNT = 20000;
+
+    std::vector<Value> make_values()
+    {
+        std::vector<Value> values;
+        for (int i = 0; i < VALUES_COUNT; ++i)
+        {
+            if (i % 4 == 0)
+            {
+                values.emplace_back(std::to_string(i));
+            }
+            else
+            {
+                values.emplace_back(i);
+            }
+        }
+
+        return values;
+    }
+}
+
+TEST_CASE("Thread pool test", "[parallel]")
+{
+    SECTION("Workers")
+    {
+        exl::thread_pool pool(3);
+        REQUIRE(pool.concurrency() == 4);
+
+        std::vector<std::atomic<int>> calls(1000);
+        for (auto& count : calls)
+        {
+            count.store(0);
+        }
+
+        auto task = [&calls](size_t index) { calls[index].fetch_add(1); };
+
+        // Pool is reusable for the consecutive jobs
+        pool.run(calls.size(), task);
+        pool.run(calls.size(), task);
+
+        size_t mismatches = 0;
+        for (auto& count : calls)
+        {
+            mismatches += size_t(count.load() != 2);
+        }
+
+        REQUIRE(mismatches == 0);
+    }
+
+    SECTION("Calling thread only")
+    {
+        exl::thread_pool pool(0);
+        REQUIRE(pool.concurrency() == 1);
+
+        size_t sum = 0;
+        auto task = [&sum](size_t index) { sum += index; };
+        pool.run(10, task);
+
+        REQUIRE(sum == 45);
+    }
+
+    SECTION("Empty job")
+    {
+        exl::thread_pool pool(2);
+
+        size_t calls = 0;
+        auto task = [&calls](size_t) { ++calls; };
+        pool.run(0, task);
+
+        REQUIRE(calls == 0);
+    }
+}
+
+TEST_CASE("Parallel match test", "[parallel]")
+{
+    exl::thread_pool pool(3);
+    auto values = make_values();
+
+    SECTION("Const range")
+    {
+        std::atomic<int64_t> sum(0);
+        std::atomic<size_t> strings(0);
+
+        const auto& range = values;
+        exl::parallel_match(
+                pool,
+                range.begin(),
+                range.end(),
+                exl::when<int>([&sum](const int& value) { sum.fetch_add(value); }),
+                exl::when<std::string>([&strings](const std::string&) { strings.fetch_add(1); })
+        );
+
+        int64_t expected = 0;
+        for (int i = 0; i < VALUES_COUNT; ++i)
+        {
+            expected += i % 4 == 0 ? 0 : i;
+        }
+
+        REQUIRE(sum.load() == expected);
+        REQUIRE(strings.load() == VALUES_COUNT / 4);
+    }
+
+    SECTION("Mutable range")
+    {
+        exl::parallel_match(
+                pool,
+                values.begin(),
+                values.end(),
+                exl::when<int>([](int& value) { value = -value; }),
+                exl::otherwise([]() {})
+        );
+
+        REQUIRE(values[1].unwrap<int>() == -1);
+        REQUIRE(values[VALUES_COUNT - 1].unwrap<int>() == -(VALUES_COUNT - 1));
+        REQUIRE(values[4].unwrap<std::string>() == "4");
+    }
+
+    SECTION("Options")
+    {
+        std::vector<exl::option<int>> options(100, exl::none());
+        options[10] = 10;
+        options[99] = 20;
+
+        std::atomic<int> sum(0);
+        exl::parallel_match(
+                pool,
+                options.begin(),
+                options.end(),
+                exl::when<int>([&sum](const int& value) { sum.fetch_add(value); }),
+                exl::otherwise([]() {})
+        );
+
+        REQUIRE(sum.load() == 30);
+    }
+}
+
+TEST_CASE("Parallel transform test", "[parallel]")
+{
+    exl::thread_pool pool(3);
+    const auto values = make_values();
+
+    std::vector<Output> results(values.size(), Output(0));
+    auto last = exl::parallel_transform<Output>(
+            pool,
+            values.begin(),
+            values.end(),
+            results.begin(),
+            exl::when<int>([](const int& value)
+            {
+                return value < 10000 ? Output(value * 2) : Output(Overflow { value });
+            }),
+            exl::when<std::string>([](const std::string& value)
+            {
+                return Output(int(value.size()));
+            })
+    );
+
+    REQUIRE(last == results.end());
+
+    // Results are in the range order, errors are reported as values
+    size_t mismatches = 0;
+    for (int i = 0; i < VALUES_COUNT; ++i)
+    {
+        const auto& result = results[size_t(i)];
+        if (i % 4 == 0)
+        {
+            mismatches += size_t(result.unwrap_ok() != int(std::to_string(i).size()));
+        }
+        else if (i < 10000)
+        {
+            mismatches += size_t(result.unwrap_ok() != i * 2);
+        }
+        else
+        {
+            mismatches += size_t(result.unwrap_error<Overflow>().value != i);
+        }
+    }
+
+    REQUIRE(mismatches == 0);
+}
@@ -0,0 +1,156 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <exl/impl/exceptions.hpp>
+#include <exl/option.hpp>
+#include <exl/pool.hpp>
+
+#include <ClassMock.hpp>
+
+using namespace exl::test;
+
+TEST_CASE("exl::pool make test", "[pool]")
+{
+    exl::pool<std::string> pool;
+
+    SECTION("Constructs value by forwarding")
+    {
+        auto value = pool.make(3, 'x');
+
+        REQUIRE(value.is_valid());
+        REQUIRE(*value == "xxx");
+    }
+
+    SECTION("Box has size of pointer")
+    {
+        REQUIRE(sizeof(exl::pool_box<std::string>) == sizeof(std::string*));
+        REQUIRE(sizeof(exl::option<exl::pool_box<std::string>>) == sizeof(std::string*));
+    }
+}
+
+TEST_CASE("exl::pool destroys value and recycles slot", "[pool]")
+{
+    exl::pool<ClassMock> pool;
+    CallCounter calls;
+
+    const ClassMock* first = nullptr;
+    {
+        auto value = pool.make(1, &calls);
+        first = &*value;
+    }
+
+    REQUIRE(calls.count(CallType::Destroy, 1) == 1);
+    REQUIRE(pool.hits() == 0);
+    REQUIRE(pool.misses() == 1);
+
+    auto recycled = pool.make(2, &calls);
+    REQUIRE(&*recycled == first);
+    REQUIRE(recycled->tag() == 2);
+    REQUIRE(pool.hits() == 1);
+    REQUIRE(pool.misses() == 1);
+}
+
+TEST_CASE("exl::pool allocates multiple chunks", "[pool]")
+{
+    exl::pool<uint64_t> pool(4);
+
+    std::vector<exl::pool_box<uint64_t>> values;
+    for (uint64_t i = 0; i < 100; ++i)
+    {
+        values.push_back(pool.make(i));
+    }
+
+    for (uint64_t i = 0; i < 100; ++i)
+    {
+        REQUIRE(*values[i] == i);
+    }
+
+    values.clear();
+    for (uint64_t i = 0; i < 100; ++i)
+    {
+        values.push_back(pool.make(i));
+    }
+
+    REQUIRE(pool.misses() == 100);
+    REQUIRE(pool.hits() == 100);
+}
+
+TEST_CASE("exl::pool recycles slots freed by other threads", "[pool]")
+{
+    exl::pool<uint64_t> pool;
+
+    std::vector<exl::pool_box<uint64_t>> values;
+    for (uint64_t i = 0; i < 1000; ++i)
+    {
+        values.push_back(pool.make(i));
+    }
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < 4; ++t)
+    {
+        std::vector<exl::pool_box<uint64_t>> part;
+        for (size_t i = t; i < values.size(); i += 4)
+        {
+            part.push_back(std::move(values[i]));
+        }
+
+        threads.emplace_back([](std::vector<exl::pool_box<uint64_t>> boxes)
+        {
+            boxes.clear();
+        }, std::move(part));
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    values.clear();
+    for (uint64_t i = 0; i < 1000; ++i)
+    {
+        values.push_back(pool.make(i));
+    }
+
+    REQUIRE(pool.misses() == 1000);
+    REQUIRE(pool.hits() == 1000);
+}
+
+#if EXL_EXCEPTIONS
+namespace
+{
+    struct ThrowingValue
+    {
+        explicit ThrowingValue(bool fail)
+        {
+            if (fail)
+            {
+                throw std::runtime_error("ThrowingValue");
+            }
+        }
+    };
+}
+
+TEST_CASE("exl::pool returns slot when constructor throws", "[pool]")
+{
+    exl::pool<ThrowingValue> pool(1);
+
+    REQUIRE_THROWS(pool.make(true));
+    REQUIRE(pool.misses() == 1);
+
+    auto value = pool.make(false);
+    REQUIRE(value.is_valid());
+    REQUIRE(pool.hits() == 1);
+    REQUIRE(pool.misses() == 1);
+}
+#endif
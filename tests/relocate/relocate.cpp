@@ -0,0 +1,120 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+#include <catch2/catch.hpp>
+
+#include <exl/box.hpp>
+#include <exl/inline_budget.hpp>
+#include <exl/mixed.hpp>
+#include <exl/option.hpp>
+#include <exl/relocate.hpp>
+#include <exl/result.hpp>
+
+#include <ClassMock.hpp>
+
+using namespace exl::test;
+
+TEST_CASE("Trivially relocatable trait test", "[relocate]")
+{
+    static_assert(
+            exl::is_trivially_relocatable<uint64_t>::value(),
+            "Trivially copyable types should be trivially relocatable"
+    );
+    static_assert(
+            !exl::is_trivially_relocatable<std::string>::value(),
+            "Types with non-trivial move should not be trivially relocatable by default"
+    );
+    static_assert(
+            exl::is_trivially_relocatable<exl::box<std::string>>::value(),
+            "exl::box with the default deleter should be trivially relocatable"
+    );
+    static_assert(
+            exl::is_trivially_relocatable<exl::mixed<int, exl::box<std::string>>>::value(),
+            "exl::mixed of trivially relocatable types should be trivially relocatable"
+    );
+    static_assert(
+            !exl::is_trivially_relocatable<exl::mixed<int, std::string>>::value(),
+            "exl::mixed with non-trivially relocatable type should not be trivially relocatable"
+    );
+    static_assert(
+            exl::is_trivially_relocatable<
+                    exl::mixed<exl::inline_budget<8>, uint64_t, std::string>
+            >::value(),
+            "Variants stored in the heap should be trivially relocatable"
+    );
+    static_assert(
+            exl::is_trivially_relocatable<exl::option<exl::box<int>>>::value(),
+            "exl::option of trivially relocatable type should be trivially relocatable"
+    );
+    static_assert(
+            exl::is_trivially_relocatable<exl::nested_mixed<int, exl::box<int>>>::value(),
+            "exl::nested_mixed of trivially relocatable types should be trivially relocatable"
+    );
+    static_assert(
+            exl::is_trivially_relocatable<exl::result<uint64_t, std::string>>::value(),
+            "exl::result with the heap errors should be trivially relocatable"
+    );
+}
+
+TEST_CASE("Relocate test", "[relocate]")
+{
+    SECTION("Trivially relocatable range is copied")
+    {
+        using Boxed = exl::box<int>;
+
+        std::array<Boxed, 3> src = {{ Boxed::make(1), Boxed::make(2), Boxed::make(3) }};
+        const int* second = &*src[1];
+
+        alignas(Boxed) unsigned char storage[sizeof(Boxed) * 3];
+        auto dest = reinterpret_cast<Boxed*>(storage);
+
+        // Source objects are destroyed by relocation, so they are released to skip destructors
+        auto end = exl::relocate(src.data(), src.data() + src.size(), dest);
+        for (auto& boxed : src)
+        {
+            boxed.release();
+        }
+
+        REQUIRE(end == dest + 3);
+        REQUIRE(*dest[0] == 1);
+        REQUIRE(&*dest[1] == second);
+        REQUIRE(*dest[2] == 3);
+
+        for (auto it = dest; it != end; ++it)
+        {
+            it->~Boxed();
+        }
+    }
+
+    SECTION("Non-trivially relocatable range is moved and destroyed")
+    {
+        CallCounter calls;
+
+        alignas(ClassMock) unsigned char srcStorage[sizeof(ClassMock) * 2];
+        alignas(ClassMock) unsigned char destStorage[sizeof(ClassMock) * 2];
+        auto src = reinterpret_cast<ClassMock*>(srcStorage);
+        auto dest = reinterpret_cast<ClassMock*>(destStorage);
+
+        new(src) ClassMock(1, &calls);
+        new(src + 1) ClassMock(2, &calls);
+
+        auto end = exl::relocate(src, src + 2, dest);
+
+        REQUIRE(end == dest + 2);
+        REQUIRE(dest[0].original_tag() == 1);
+        REQUIRE(dest[1].original_tag() == 2);
+        REQUIRE(calls.count(CallType::Move, 1) == 1);
+        REQUIRE(calls.count(CallType::Move, 2) == 1);
+        REQUIRE(calls.count(CallType::Destroy, 1) == 1);
+        REQUIRE(calls.count(CallType::Destroy, 2) == 1);
+
+        dest[0].~ClassMock();
+        dest[1].~ClassMock();
+    }
+}
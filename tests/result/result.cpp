@@ -0,0 +1,366 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <exl/result.hpp>
+
+#include <ClassMock.hpp>
+
+using namespace exl::test;
+
+namespace
+{
+    struct Error
+    {
+        virtual ~Error() = default;
+    };
+
+    struct ParseError : Error
+    {
+        ParseError(std::string what, size_t line)
+                : what(std::move(what))
+                , line(line) {}
+
+        std::string what;
+        size_t line;
+    };
+
+    struct IoError : Error
+    {
+        explicit IoError(int code)
+                : code(code) {}
+
+        int code;
+    };
+
+    enum class Errc : uint8_t
+    {
+        Timeout,
+        Refused
+    };
+
+    using Result = exl::result<uint64_t, ParseError, IoError, Errc>;
+}
+
+TEST_CASE("Result layout test", "[result]")
+{
+    SECTION("Large errors are stored in the heap")
+    {
+        static_assert(
+                sizeof(Result) == sizeof(exl::mixed<uint64_t, Errc>),
+                "exl::result should occupy only value storage and tag"
+        );
+        static_assert(
+                std::is_same<
+                        Result::mixed_t::storage_type_list_t,
+                        exl::impl::type_list<
+                                uint64_t,
+                                exl::impl::mixed_boxed<ParseError>,
+                                exl::impl::mixed_boxed<IoError>,
+                                Errc
+                        >
+                >::value,
+                "Only errors which don't fit into the value storage should be cold"
+        );
+    }
+
+    SECTION("Errors which fit into the value storage are stored inline")
+    {
+        using Large = std::array<char, 64>;
+        using LargeResult = exl::result<Large, std::string>;
+
+        static_assert(
+                std::is_same<
+                        LargeResult::mixed_t::storage_type_list_t,
+                        exl::impl::type_list<Large, std::string>
+                >::value,
+                "Error which fits into the value storage should be inline"
+        );
+    }
+
+    SECTION("Trivial results stay trivial")
+    {
+        using TrivialResult = exl::result<uint64_t, Errc>;
+
+        static_assert(
+                std::is_trivially_copyable<TrivialResult>::value,
+                "exl::result of trivial types should be trivially copyable"
+        );
+        static_assert(
+                std::is_trivially_destructible<TrivialResult>::value,
+                "exl::result of trivial types should be trivially destructible"
+        );
+    }
+}
+
+TEST_CASE("Result construction test", "[result]")
+{
+    SECTION("Value")
+    {
+        Result r(uint64_t(42));
+
+        REQUIRE(r.is_ok());
+        REQUIRE(!r.is_error());
+        REQUIRE(!r.is_error<Error>());
+        REQUIRE(r.unwrap_ok() == 42);
+    }
+
+    SECTION("Inline error")
+    {
+        Result r(Errc::Refused);
+
+        REQUIRE(r.is_error());
+        REQUIRE(r.is_error<Errc>());
+        REQUIRE(!r.is_error<Error>());
+        REQUIRE(r.unwrap_error<Errc>() == Errc::Refused);
+    }
+
+    SECTION("Cold error")
+    {
+        Result r(IoError(5));
+
+        REQUIRE(!r.is_ok());
+        REQUIRE(r.is_error<IoError>());
+        REQUIRE(r.is_error<Error>());
+        REQUIRE(!r.is_error<ParseError>());
+        REQUIRE(r.unwrap_error<IoError>().code == 5);
+        REQUIRE(&r.unwrap_error<Error>() == &r.unwrap_error<IoError>());
+    }
+
+    SECTION("Make")
+    {
+        auto ok = Result::make_ok(uint64_t(7));
+        REQUIRE(ok.unwrap_ok() == 7);
+
+        auto error = Result::make_error<ParseError>("unexpected token", 3);
+        REQUIRE(error.unwrap_error<ParseError>().what == "unexpected token");
+        REQUIRE(error.unwrap_error<ParseError>().line == 3);
+    }
+
+    SECTION("Cold error is constructed in-place")
+    {
+        CallCounter counter;
+
+        auto r = exl::result<int, ClassMock>::make_error<ClassMock>(4, &counter);
+
+        REQUIRE(r.unwrap_error<ClassMock>().tag() == 4);
+        REQUIRE(counter.count(CallType::Construct, 4) == 1);
+        REQUIRE(counter.count(CallType::Copy, 4) == 0);
+        REQUIRE(counter.count(CallType::Move, 4) == 0);
+    }
+}
+
+TEST_CASE("Result copy and move test", "[result]")
+{
+    auto error = Result::make_error<ParseError>("eof", 10);
+
+    SECTION("Copy of the cold error allocates new error")
+    {
+        Result copy(error);
+
+        REQUIRE(&copy.unwrap_error<ParseError>() != &error.unwrap_error<ParseError>());
+        REQUIRE(copy.unwrap_error<ParseError>().what == "eof");
+        REQUIRE(error.unwrap_error<ParseError>().what == "eof");
+    }
+
+    SECTION("Move of the cold error moves the heap storage")
+    {
+        const ParseError* original = &error.unwrap_error<ParseError>();
+
+        Result moved(std::move(error));
+
+        REQUIRE(&moved.unwrap_error<ParseError>() == original);
+        REQUIRE(error.is_error<ParseError>());
+    }
+
+    SECTION("Assignment")
+    {
+        Result r(uint64_t(1));
+
+        r = error;
+        REQUIRE(r.unwrap_error<ParseError>().line == 10);
+
+        r = Result::make_error<ParseError>("other", 11);
+        REQUIRE(r.unwrap_error<ParseError>().what == "other");
+
+        r = error;
+        REQUIRE(r.unwrap_error<ParseError>().what == "eof");
+
+        r = Result(uint64_t(2));
+        REQUIRE(r.unwrap_ok() == 2);
+    }
+}
+
+TEST_CASE("Result map test", "[result]")
+{
+    auto describe = [](const Result& r) -> std::string
+    {
+        return r.map<std::string>(
+                exl::when<uint64_t>([](uint64_t value)
+                {
+                    return std::to_string(value);
+                }),
+                exl::when<ParseError>([](const ParseError& e)
+                {
+                    return e.what;
+                }),
+                exl::when<Error>([](const Error&)
+                {
+                    return std::string("error");
+                }),
+                exl::otherwise([]()
+                {
+                    return std::string("errc");
+                })
+        );
+    };
+
+    REQUIRE(describe(Result(uint64_t(42))) == "42");
+    REQUIRE(describe(Result::make_error<ParseError>("bad", 1)) == "bad");
+    REQUIRE(describe(Result(IoError(2))) == "error");
+    REQUIRE(describe(Result(Errc::Timeout)) == "errc");
+
+    SECTION("Match")
+    {
+        int matched = 0;
+
+        Result(IoError(3)).match(
+                exl::when<IoError>([&matched](const IoError& e) { matched = e.code; }),
+                exl::otherwise([]() {})
+        );
+
+        REQUIRE(matched == 3);
+    }
+}
+
+namespace
+{
+    using IoResult = exl::result<std::string, IoError, Errc>;
+    using ConfigResult = exl::result<uint64_t, ParseError, IoError, Errc>;
+    using ReorderedResult = exl::result<uint64_t, Errc, ParseError, IoError>;
+
+    IoResult read_file(int code)
+    {
+        if (code != 0)
+        {
+            return IoError(code);
+        }
+
+        return std::string("42");
+    }
+
+    template <typename Result>
+    Result load_config(int code)
+    {
+        EXL_TRY(std::string text, read_file(code));
+        return uint64_t(std::stoull(text));
+    }
+}
+
+TEST_CASE("Result error propagation test", "[result]")
+{
+    SECTION("Value")
+    {
+        auto r = load_config<ConfigResult>(0);
+
+        REQUIRE(r.is_ok());
+        REQUIRE(r.unwrap_ok() == 42);
+    }
+
+    SECTION("Error of the suffix error types is moved as is")
+    {
+        static_assert(
+                exl::impl::type_list_is_suffix_of<
+                        exl::impl::type_list<exl::impl::mixed_boxed<IoError>, Errc>,
+                        ConfigResult::mixed_t::storage_type_list_t
+                >::value(),
+                "Error types of the source result should be suffix of the destination errors"
+        );
+
+        auto r = load_config<ConfigResult>(5);
+
+        REQUIRE(r.is_error<IoError>());
+        REQUIRE(r.unwrap_error<IoError>().code == 5);
+    }
+
+    SECTION("Error of the reordered error types is converted")
+    {
+        auto r = load_config<ReorderedResult>(7);
+
+        REQUIRE(r.is_error<IoError>());
+        REQUIRE(r.unwrap_error<IoError>().code == 7);
+
+        ReorderedResult errc = IoResult(Errc::Timeout).propagate_error();
+        REQUIRE(errc.unwrap_error<Errc>() == Errc::Timeout);
+    }
+
+    SECTION("Heap error storage is moved")
+    {
+        using ColdIoResult = exl::result<uint64_t, IoError, Errc>;
+
+        auto source = ColdIoResult(IoError(3));
+        const IoError* original = &source.unwrap_error<IoError>();
+
+        ConfigResult r = std::move(source).propagate_error();
+
+        REQUIRE(&r.unwrap_error<IoError>() == original);
+        REQUIRE(source.is_error<IoError>());
+    }
+
+    SECTION("Moved-from heap error can be copied and assigned")
+    {
+        auto source = Result(IoError(4));
+        Result moved(std::move(source));
+
+        Result copy(source);
+        REQUIRE(copy.is_error<IoError>());
+
+        copy = moved;
+        REQUIRE(copy.unwrap_error<IoError>().code == 4);
+
+        source = moved;
+        ConfigResult r = std::move(source).propagate_error();
+        REQUIRE(r.unwrap_error<IoError>().code == 4);
+        REQUIRE(moved.unwrap_error<IoError>().code == 4);
+    }
+
+    SECTION("Propagated error can't be stored")
+    {
+        using Propagated = decltype(std::declval<IoResult>().propagate_error());
+
+        static_assert(
+                !std::is_copy_constructible<Propagated>::value
+                        && !std::is_move_constructible<Propagated>::value,
+                "Propagated error refers to the source result and should not be stored"
+        );
+        static_assert(
+                !std::is_constructible<ConfigResult, Propagated&>::value,
+                "Only the propagated error rvalue should be converted"
+        );
+        static_assert(
+                std::is_constructible<ConfigResult, Propagated&&>::value,
+                "Propagated error rvalue should be converted"
+        );
+    }
+}
+
+TEST_CASE("Result swap test", "[result]")
+{
+    Result ok(uint64_t(1));
+    auto error = Result::make_error<ParseError>("eof", 2);
+    const ParseError* original = &error.unwrap_error<ParseError>();
+
+    std::swap(ok, error);
+
+    REQUIRE(error.unwrap_ok() == 1);
+    REQUIRE(&ok.unwrap_error<ParseError>() == original);
+}
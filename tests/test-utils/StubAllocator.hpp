@@ -0,0 +1,118 @@
+// Copyright (C) 2019 Vladislav Nikonov <mail@pacmancoder.xyz>
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at https://www.boost.org/LICENSE_1_0.txt)
+#pragma once
+
+#include <cstddef>
+#include <new>
+
+namespace exl { namespace test
+{
+    /// @brief Counts allocations of the StubAllocator instances which point to it
+    struct StubArena
+    {
+        size_t allocations = 0;
+        size_t deallocations = 0;
+        size_t allocated = 0;
+        bool fail = false;
+    };
+
+    /// @brief Stateful allocator which allocates from the global heap and records allocations
+    /// in the arena. Throws std::bad_alloc when the arena is set to fail
+    template <typename T>
+    class StubAllocator
+    {
+    public:
+        template <typename U>
+        friend class StubAllocator;
+
+        using value_type = T;
+
+    public:
+        StubAllocator() noexcept
+                : arena_(nullptr) {}
+
+        explicit StubAllocator(StubArena* arena) noexcept
+                : arena_(arena) {}
+
+        template <typename U>
+        StubAllocator(const StubAllocator<U>& rhs) noexcept
+                : arena_(rhs.arena_) {}
+
+        T* allocate(size_t count)
+        {
+            if (arena_->fail)
+            {
+                throw std::bad_alloc();
+            }
+
+            ++arena_->allocations;
+            arena_->allocated += count;
+            return static_cast<T*>(::operator new(count * sizeof(T)));
+        }
+
+        void deallocate(T* ptr, size_t count) noexcept
+        {
+            ++arena_->deallocations;
+            arena_->allocated -= count;
+            ::operator delete(ptr);
+        }
+
+        StubArena* arena() const noexcept
+        {
+            return arena_;
+        }
+
+        template <typename U>
+        bool operator==(const StubAllocator<U>& rhs) const noexcept
+        {
+            return arena_ == rhs.arena_;
+        }
+
+        template <typename U>
+        bool operator!=(const StubAllocator<U>& rhs) const noexcept
+        {
+            return arena_ != rhs.arena_;
+        }
+
+    private:
+        StubArena* arena_;
+    };
+
+    /// @brief Stateless allocator which allocates from the global heap
+    template <typename T>
+    class StubStatelessAllocator
+    {
+    public:
+        using value_type = T;
+
+    public:
+        StubStatelessAllocator() noexcept = default;
+
+        template <typename U>
+        StubStatelessAllocator(const StubStatelessAllocator<U>&) noexcept {}
+
+        T* allocate(size_t count)
+        {
+            return static_cast<T*>(::operator new(count * sizeof(T)));
+        }
+
+        void deallocate(T* ptr, size_t) noexcept
+        {
+            ::operator delete(ptr);
+        }
+
+        template <typename U>
+        bool operator==(const StubStatelessAllocator<U>&) const noexcept
+        {
+            return true;
+        }
+
+        template <typename U>
+        bool operator!=(const StubStatelessAllocator<U>&) const noexcept
+        {
+            return false;
+        }
+    };
+}}